@@ -29,21 +29,110 @@
  * @param generator a random number generator.
  * @param digraph true (default): digraph, false: no digraph.
  * @param loopsAllowed true (default): loops enabled, false: loops disabled.
+ * @param storage ADJACENCYMATRIX (default), ADJACENCYLIST or BITMATRIX.
+ * @param components COMPONENTSEARCH (default), COMPONENTTRACKING or DYNAMICCONNECTIVITY.
+ * @param digraphComponents REACHABLECOMPONENTS (default), WEAKCOMPONENTS or STRONGCOMPONENTS,
+ *       ignored for undirected graphs.
  */
-AbstractGraph::AbstractGraph(int n, RandomGenerator* generator, bool digraph, bool loopsAllowed) {
+AbstractGraph::AbstractGraph(int n, RandomGenerator* generator, bool digraph, bool loopsAllowed,
+                             int storage, int components, int digraphComponents) {
     randomGenerator = generator;
     numberOfVertices = n;
     numberOfEdges = 0; // initially the graph has no edges
+    degree = new int[n];
      // Per convention is the size of the largest component -1, as long it has not been calculated.
     largestComponentSize = -1;
     numberOfComponents = -1;
-    adjacencyMatrix = new bool*[n];
+    isDigraph = digraph;
+    loopsEnabled = loopsAllowed;
+    storageType = storage;
+    adjacencyMatrix = NULL;
+    adjacencyList = NULL;
+    bitMatrix = NULL;
+    markedBits = NULL;
+    if (storageType == ADJACENCYMATRIX) {
+        adjacencyMatrix = new bool*[n];
+        for (int i = 0; i < n; i++) {
+            adjacencyMatrix[i] = new bool[n];
+        }
+    } else if (storageType == ADJACENCYLIST) {
+        adjacencyList = new AdjacencyList(n, digraph);
+    } else if (storageType == BITMATRIX) {
+        bitMatrix = new BitMatrix(n, digraph);
+        // the marked vertices are packed like a row of the matrix
+        markedBits = new uint64_t[bitMatrix->getWordsPerRow()];
+    } else {
+        perror(("Invalid storage " + numToStr(storage)).c_str());
+        exit(EXIT_FAILURE);
+    }
+    // auxiliary arrays for the depth-first search
+    marked = new bool[n];
+    searchPosition = new int[n];
+    searchStack = new int[n];
+    // auxiliary arrays for the components of a digraph
+    digraphComponentType = digraph ? digraphComponents : REACHABLECOMPONENTS;
+    unionParent = NULL;
+    unionSize = NULL;
+    tarjanIndex = NULL;
+    tarjanLowLink = NULL;
+    tarjanStack = NULL;
+    if (digraphComponentType == WEAKCOMPONENTS) {
+        unionParent = new int[n];
+        unionSize = new int[n];
+    } else if (digraphComponentType == STRONGCOMPONENTS) {
+        tarjanIndex = new int[n];
+        tarjanLowLink = new int[n];
+        tarjanStack = new int[n];
+    } else if (digraphComponentType != REACHABLECOMPONENTS) {
+        perror(("Invalid digraph components " + numToStr(digraphComponents)).c_str());
+        exit(EXIT_FAILURE);
+    }
+    // the labels and sizes of the components of the last component pass
+    componentLabel = new int[n];
+    componentSize = new int[n];
+    componentSizeCounter = new int[n + 1];
+    componentsLabeled = false;
+    componentSizesCounted = false;
+    journalComponentsLabeled = false;
+    // the neighbors of the choosen vertex in the candidate graph
+    proposedNeighbor = new bool[n];
     for (int i = 0; i < n; i++) {
-        adjacencyMatrix[i] = new bool[n];
+        proposedNeighbor[i] = false;
+    }
+    candidateVertex = -1;
+    candidateApplied = false;
+    candidateEvaluated = false;
+    componentTracker = NULL;
+    dynamicConnectivity = NULL;
+    formerNeighbors = NULL;
+    searchStacks = NULL;
+    visited = NULL;
+    if (((components == COMPONENTTRACKING) || (components == DYNAMICCONNECTIVITY)) && isDigraph) {
+        perror("Tracking the components requires an undirected graph");
+        exit(EXIT_FAILURE);
+    }
+    if (components == COMPONENTTRACKING) {
+        componentTracker = new ComponentTracker(n);
+        formerNeighbors = new int[n];
+        // one search for each former neighbor, the stacks keep their capacity
+        searchStacks = new std::vector<int>[n];
+        searchOwner = new int[n];
+        searchGroup = new int[n];
+        openSearches = new int[n];
+        visitOrder = new int[n];
+        pieceVertices = new int[n];
+        visited = new int[n];
+        for (int i = 0; i < n; i++) {
+            visited[i] = 0;
+        }
+        visitStamp = 0;
+    } else if (components == DYNAMICCONNECTIVITY) {
+        dynamicConnectivity = new DynamicConnectivity(n);
+    } else if (components != COMPONENTSEARCH) {
+        perror(("Invalid components " + numToStr(components)).c_str());
+        exit(EXIT_FAILURE);
     }
     AbstractGraph::resetGraph(); // initially all fields of the adjacency matrix should be zero
-    isDigraph = digraph;
-    loopsEnabled = loopsAllowed;
 }
 
 /******************* Destructor *******************/
@@ -52,10 +141,44 @@ AbstractGraph::AbstractGraph(int n, RandomGenerator* generator, bool digraph, bo
  * Destructor.
  */
 AbstractGraph::~AbstractGraph() {
-     for (int i = 0; i < numberOfVertices; i++) {
-         delete [] adjacencyMatrix[i];
-     }
-     delete [] adjacencyMatrix;
+    if (storageType == ADJACENCYMATRIX) {
+        for (int i = 0; i < numberOfVertices; i++) {
+            delete [] adjacencyMatrix[i];
+        }
+        delete [] adjacencyMatrix;
+    } else if (storageType == ADJACENCYLIST) {
+        delete adjacencyList;
+    } else {
+        delete bitMatrix;
+        delete [] markedBits;
+    }
+    delete [] degree;
+    delete [] marked;
+    delete [] searchPosition;
+    delete [] searchStack;
+    delete [] unionParent;
+    delete [] unionSize;
+    delete [] tarjanIndex;
+    delete [] tarjanLowLink;
+    delete [] tarjanStack;
+    delete [] componentLabel;
+    delete [] componentSize;
+    delete [] componentSizeCounter;
+    delete [] proposedNeighbor;
+    if (componentTracker != NULL) {
+        delete componentTracker;
+        delete [] formerNeighbors;
+        delete [] searchStacks;
+        delete [] searchOwner;
+        delete [] searchGroup;
+        delete [] openSearches;
+        delete [] visitOrder;
+        delete [] pieceVertices;
+        delete [] visited;
+    }
+    if (dynamicConnectivity != NULL) {
+        delete dynamicConnectivity;
+    }
 }
 
 /******************* getter *******************/
@@ -69,6 +192,31 @@ int AbstractGraph::getNumberOfEdges() {
     return(numberOfEdges);
 }
 
+/**
+ * Return the number of vertices without an edge to another vertex, loops are ignored.
+ * The degrees are updated by each change of an edge, hence this costs O(1).
+ *
+ * @return the number of isolated vertices.
+ */
+int AbstractGraph::getNumberOfIsolatedVertices() {
+    return(numberOfIsolatedVertices);
+}
+
+/**
+ * Return the size of the 2-core, which is the largest subgraph, whose vertices have
+ * at least two neighbors in the subgraph. It is calculated by removing the vertices
+ * with less than two remaining neighbors in O(N + M) (list) or O(N^2) (matrix)
+ * and stays valid until the graph is changed. Loops are ignored. Undirected graphs only.
+ *
+ * @return the number of vertices of the 2-core.
+ */
+int AbstractGraph::getSizeOfTwoCore() {
+    if (twoCoreSize == -1) {
+        AbstractGraph::twoCore();
+    }
+    return(twoCoreSize);
+}
+
 /**
  * Return the number of vertices of the graph.
  *
@@ -80,6 +228,7 @@ int AbstractGraph::getNumberOfVertices() {
 
 /**
  * Return the entry of the adjacency matrix for the given vertices.
+ * For undirected graphs the entry is symmetric.
  *
  * @param vertex1 the index of the first vertex.
  * @param vertex2 the index of the second vertex.
@@ -87,7 +236,16 @@ int AbstractGraph::getNumberOfVertices() {
  * @return the entry of the tuple (vertex1, vertex2).
  */
 int AbstractGraph::getAdjacencyMatrixEntry(int vertex1, int vertex2) {
-    return(adjacencyMatrix[vertex1][vertex2]);
+    return(AbstractGraph::hasEdge(vertex1, vertex2));
+}
+
+/**
+ * Return how the edges are stored.
+ *
+ * @return ADJACENCYMATRIX, ADJACENCYLIST or BITMATRIX.
+ */
+int AbstractGraph::getStorage() {
+    return(storageType);
 }
 
 /**
@@ -124,6 +282,12 @@ RandomGenerator* AbstractGraph::getRandomGenerator() {
  * @return the size of the largest component.
  */
 int AbstractGraph::getSizeOfLargestComponent() {
+    if (componentTracker != NULL) {
+        return(componentTracker->getSizeOfLargestComponent());
+    }
+    if (dynamicConnectivity != NULL) {
+        return(dynamicConnectivity->getSizeOfLargestComponent());
+    }
     if (largestComponentSize == -1) {
         // recalculate the size of the largest component
         AbstractGraph::sizeOfLargestComponent();
@@ -138,13 +302,80 @@ int AbstractGraph::getSizeOfLargestComponent() {
  * @return the number of components.
  */
 int AbstractGraph::getNumberOfComponents() {
-    if (largestComponentSize == -1) {
+    if (componentTracker != NULL) {
+        return(componentTracker->getNumberOfComponents());
+    }
+    if (dynamicConnectivity != NULL) {
+        return(dynamicConnectivity->getNumberOfComponents());
+    }
+    if ((largestComponentSize == -1) || (numberOfComponents == -1)) {
         // recalculate the size of the largest component
         AbstractGraph::sizeOfLargestComponent();
     }
     return(numberOfComponents);
 }
 
+/**
+ * Return the label of the component of the given vertex. The labels are numbered
+ * from zero to getNumberOfComponents() - 1. The labels and sizes are produced by one
+ * component pass, the histogram of the sizes is counted from them on request. All of
+ * them stay valid until the graph is changed, afterwards the next request repeats the pass.
+ *
+ * @param vertex the index of the given vertex.
+ *
+ * @return the label of the component.
+ */
+int AbstractGraph::getComponentOfVertex(int vertex) {
+    if (!componentsLabeled) {
+        AbstractGraph::sizeOfLargestComponent();
+    }
+    return(componentLabel[vertex]);
+}
+
+/**
+ * Return the size of the component with the given label.
+ *
+ * @param component the label of the component.
+ *
+ * @return the size of the component.
+ */
+int AbstractGraph::getSizeOfComponent(int component) {
+    if (!componentsLabeled) {
+        AbstractGraph::sizeOfLargestComponent();
+    }
+    return(componentSize[component]);
+}
+
+/**
+ * Return how many components have the given size. If the components are tracked,
+ * the sizes are taken from the tracking structure without a component pass.
+ *
+ * @param size the size of the components, between 0 and numberOfVertices.
+ *
+ * @return the number of components of the given size.
+ */
+int AbstractGraph::getNumberOfComponentsOfSize(int size) {
+    if (componentTracker != NULL) {
+        return(componentTracker->getNumberOfComponentsOfSize(size));
+    }
+    if (dynamicConnectivity != NULL) {
+        return(dynamicConnectivity->getNumberOfComponentsOfSize(size));
+    }
+    if (!componentsLabeled) {
+        AbstractGraph::sizeOfLargestComponent();
+    }
+    if (!componentSizesCounted) {
+        for (int i = 0; i <= numberOfVertices; i++) {
+            componentSizeCounter[i] = 0;
+        }
+        for (int i = 0; i < numberOfComponents; i++) {
+            componentSizeCounter[componentSize[i]]++;
+        }
+        componentSizesCounted = true;
+    }
+    return(componentSizeCounter[size]);
+}
+
 /******************* graph generators *******************/
 
 /**
@@ -153,18 +384,17 @@ int AbstractGraph::getNumberOfComponents() {
  * This means all non diagonal elements of the adjacency matrix have to be set true.
  */
 void AbstractGraph::generateCompleteGraph() {
-    numberOfEdges = 0;
-    largestComponentSize = numberOfVertices;
-    numberOfComponents = 1;
+    if (numberOfEdges != 0) {
+        AbstractGraph::resetGraph();
+    }
     if (isDigraph) {
         // treat case of an directed graph
         for (int i = 0; i < numberOfVertices; i++) {
             for (int j = 0; j < numberOfVertices; j++) {
                 if (i != j) {
-                    adjacencyMatrix[i][j] = true;
+                    AbstractGraph::storeEdge<true>(i, j);
+                    AbstractGraph::addDegree(i, j);
                     numberOfEdges++;
-                } else {
-                    adjacencyMatrix[i][j] = false;
                 }
             }
         }
@@ -173,11 +403,16 @@ void AbstractGraph::generateCompleteGraph() {
         for (int i = 0; i < numberOfVertices; i++) {
             // just iterate over all i + 1 elements, because edge (a, b) = (b, a)
             for (int j = i + 1; j < numberOfVertices; j++) {
-                adjacencyMatrix[j][i] = true;
+                AbstractGraph::storeEdge<false>(j, i);
+                AbstractGraph::addDegree(j, i);
                 numberOfEdges++;
             }
         }
     }
+    largestComponentSize = numberOfVertices;
+    numberOfComponents = 1;
+    componentsLabeled = false;
+    twoCoreSize = -1;
 }
 
 /**
@@ -191,93 +426,180 @@ void AbstractGraph::generateLine() {
     }
     // insert an edge from vertex i to vertex i + 1
     for (int i = 0; i < (numberOfVertices - 1); i++) {
-        adjacencyMatrix[(i + 1)][i] = true;
+        AbstractGraph::storeEdge<false>(i + 1, i);
+        AbstractGraph::addDegree(i + 1, i);
+        numberOfEdges++;
     }
-    numberOfEdges = numberOfVertices;
     largestComponentSize = numberOfVertices;
     numberOfComponents = 1;
+    componentsLabeled = false;
+    twoCoreSize = -1;
+    if (isDigraph && (digraphComponentType != WEAKCOMPONENTS)) {
+        // no vertex reaches a vertex with a bigger index
+        largestComponentSize = (numberOfVertices > 0) ? 1 : 0;
+        numberOfComponents = numberOfVertices;
+    }
 }
 
 /**
- * Generate a graph with randomly setted edges.
+ * Propose a candidate graph, where one vertex is choosen randomly. All edges of this
+ * vertex are replaced by feasible edges, which are drawn with a certain probability.
+ * The proposed edges are only saved, the graph is not changed.
+ *
+ * @return the index of the choosen vertex.
  */
-void AbstractGraph::generateRandom() {
-    if (numberOfEdges != 0) {
-        AbstractGraph::resetGraph();
-    }
-    if (isDigraph) {
-        for (int i = 0; i < numberOfVertices; i++) {
-            for (int j = 0; j < numberOfVertices; j++) {
-                if (mustInsertEdge(i, j)) {
-                    AbstractGraph::addEdgeDigraph(i, j);
-                }
-            }
+int AbstractGraph::proposeCandidateGraph() {
+    // 1. step: choose vertex X randomly
+    candidateVertex = randomGenerator->randomVertex(numberOfVertices);
+    // 2. step: propose all feasible edges (with probability), the proposal keeps its capacity
+    proposal.clear();
+    candidateApplied = false;
+    candidateEvaluated = false;
+    proposeEdgesRandom(candidateVertex); // virtual, implemented by the model
+
+    return(candidateVertex);
+}
+
+/**
+ * Return the size of the largest component of the proposed candidate graph.
+ * If the components are searched, the candidate graph is explored without changing
+ * the graph, the search stops as soon as a component is bigger than the given bound.
+ * If the components are tracked, the candidate graph is applied and the
+ * previous state is saved in the undo journal of the graph.
+ *
+ * @param bound the maximum size, which is of interest (default: no bound).
+ *
+ * @return the size of the largest component of the candidate graph
+ *       or a value bigger than the bound.
+ */
+int AbstractGraph::evaluateCandidateGraph(int bound) {
+    if ((componentTracker != NULL) || (dynamicConnectivity != NULL)) {
+        // the tracked components are updated by applying the candidate graph
+        if (!candidateApplied) {
+            AbstractGraph::applyCandidateGraph();
         }
-    } else {
-        for (int i = 0; i < numberOfVertices; i++) {
-            // just iterate over all i + 1 elements, because edge (a, b) = (b, a)
-            for (int j = i; j < numberOfVertices; j++) {
-                if (mustInsertEdge(i, j)) {
-                    AbstractGraph::addEdgeNonDigraph(i, j);
-                }
-            }
+        return(AbstractGraph::getSizeOfLargestComponent());
+    }
+    if ((bound >= numberOfVertices) || (digraphComponentType != REACHABLECOMPONENTS)) {
+        // without a bound the search on the applied candidate graph is cheaper,
+        // the weakly and strongly connected components are calculated on the applied graph
+        if (!candidateApplied) {
+            AbstractGraph::applyCandidateGraph();
         }
+        return(AbstractGraph::getSizeOfLargestComponent());
+    }
+    if (!candidateEvaluated) {
+        // an exceeded bound leaves the candidate graph unevaluated
+        candidateEvaluated = AbstractGraph::sizeOfLargestCandidateComponent(bound);
     }
+    return(candidateLargestComponentSize);
 }
 
 /**
- * Generate a candidate graph, where one vertex is choosen randomly. After removing
- * all edges of this vertex, one inserts all feasible edges with a certain probability.
- *
- * @param vertex, pointer to a vertex, which will contain the choosen vertex after
- *       calling this function.
- *
- * @return a backup of the current state.
+ * Accept the proposed candidate graph, such that it becomes the current graph.
  */
-previousState AbstractGraph::generateCandidateGraph(int *vertex) {
-    // 1. step: choose vertex X randomly
-    *vertex = randomGenerator->randomVertex(numberOfVertices);
-    // 2. step: generate backup
-    previousState safedState;
-    safedState.numberOfComponents = numberOfComponents;
-    safedState.numberOfEdges = numberOfEdges;
-    safedState.sizeLargestComp = largestComponentSize;
-    // 3. step: delete all edges of X
-    safedState.edgesStack = AbstractGraph::removeAllEdgesOfVertex(*vertex);
-    // 4. step: insert all feasible edges (with probability)
-    AbstractGraph::insertEdgesRandom(*vertex);
+void AbstractGraph::acceptCandidateGraph() {
+    if (!candidateApplied) {
+        AbstractGraph::applyCandidateGraph();
+    }
+    if (candidateEvaluated) {
+        // the components of the candidate graph are already known
+        largestComponentSize = candidateLargestComponentSize;
+        numberOfComponents = candidateComponents;
+    }
+    journal.clear();
+    candidateApplied = false;
+    candidateEvaluated = false;
+}
 
-    return(safedState);
+/**
+ * Reject the proposed candidate graph, such that the current graph is kept.
+ */
+void AbstractGraph::rejectCandidateGraph() {
+    if (candidateApplied) {
+        AbstractGraph::revertCandidateGraph();
+    }
+    candidateApplied = false;
+    candidateEvaluated = false;
 }
 
 /**
- * Revert the step graph => candidate. Remove all edges of the given
- * vertex and add all old ones.
- *
- * @param vertex, the index of the given vertex.
- * @param safedState, backup of the previous state.
+ * Apply the proposed candidate graph, if it has not been applied yet. The removed edges
+ * and the previous counts are saved in the undo journal, such that rejectCandidateGraph
+ * can restore the previous state.
+ */
+void AbstractGraph::applyCandidateGraph() {
+    if (candidateApplied) {
+        return;
+    }
+    // 1. step: save the counts, the journal keeps its capacity
+    journal.clear();
+    journalComponents = numberOfComponents;
+    journalEdges = numberOfEdges;
+    journalLargestComponentSize = largestComponentSize;
+    journalTwoCoreSize = twoCoreSize;
+    journalComponentsLabeled = componentsLabeled;
+    // 2. step: delete all edges of X
+    AbstractGraph::removeAllEdgesOfVertex(candidateVertex);
+    // 3. step: insert the proposed edges
+    for (int i = 0; i < (int) proposal.size(); i++) {
+        AbstractGraph::addEdge(proposal[i].head, proposal[i].tail);
+    }
+    candidateApplied = true;
+}
+
+/**
+ * Revert the applied candidate graph. Remove all edges of the choosen
+ * vertex and add all old ones from the undo journal.
  */
-void AbstractGraph::revertGenerateCandidateGraph(int vertex, previousState safedState) {
-    // 1. remove all edges of the given vertex
-    AbstractGraph::removeAllEdgesOfVertex(vertex);
-    // 2. add all edges from the stack
-    while (!safedState.edgesStack.empty()) {
-        AbstractGraph::addEdge(safedState.edgesStack.top().head, safedState.edgesStack.top().tail);
-        safedState.edgesStack.pop();
+void AbstractGraph::revertCandidateGraph() {
+    int oldEdges = (int) journal.size();
+    // 1. remove all edges of the given vertex, they are appended behind the old ones
+    AbstractGraph::removeAllEdgesOfVertex(candidateVertex);
+    // 2. add all old edges in reverse order of their removal
+    for (int i = oldEdges - 1; i >= 0; i--) {
+        AbstractGraph::addEdge(journal[i].head, journal[i].tail);
     }
+    journal.clear();
     // 3. reset properties of the state
-    AbstractGraph::largestComponentSize = safedState.sizeLargestComp;
-    AbstractGraph::numberOfComponents = safedState.numberOfComponents;
-    AbstractGraph::numberOfEdges = safedState.numberOfEdges;
+    AbstractGraph::largestComponentSize = journalLargestComponentSize;
+    AbstractGraph::numberOfComponents = journalComponents;
+    AbstractGraph::numberOfEdges = journalEdges;
+    AbstractGraph::twoCoreSize = journalTwoCoreSize;
+    // the labels are valid again, unless the candidate graph has been labeled
+    AbstractGraph::componentsLabeled = journalComponentsLabeled;
+    candidateApplied = false;
 }
 
 /**
- * Set all elements of the adjacency matrix to false.
+ * Remove all edges of the graph.
  */
 void AbstractGraph::resetGraph() {
     numberOfEdges = 0;
+    for (int i = 0; i < numberOfVertices; i++) {
+        degree[i] = 0;
+    }
+    numberOfIsolatedVertices = numberOfVertices;
+    twoCoreSize = -1;
     largestComponentSize = -1;
     numberOfComponents = -1;
+    componentsLabeled = false;
+    if (componentTracker != NULL) {
+        componentTracker->reset();
+    }
+    if (dynamicConnectivity != NULL) {
+        dynamicConnectivity->reset();
+    }
+    if (storageType == ADJACENCYLIST) {
+        // O(N + M) instead of O(N^2)
+        adjacencyList->clear();
+        return;
+    }
+    if (storageType == BITMATRIX) {
+        // word-wide clear of the whole buffer
+        bitMatrix->clear();
+        return;
+    }
     for (int i = 0; i < numberOfVertices; i++) {
         for (int j = 0; j < numberOfVertices; j++) {
             adjacencyMatrix[i][j] = false;
@@ -304,65 +626,126 @@ void AbstractGraph::generateRandomEdge() {
 }
 
 /**
- * This function inserts for the given index all feasible edges with
- * a certain probability.
- * Note: This function requires that all inheriting classes overwrite
- * function mustInsertEdge which decides for a vertex, if it is inserted.
+ * Append the given edge to the proposed edges of the candidate graph, if possible.
+ *
+ * @tparam loops true: loops enabled, false: loops disabled, must equal loopsEnabled.
+ *
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ */
+template <bool loops>
+void AbstractGraph::proposeEdge(int vertex1, int vertex2) {
+    if (loops || (vertex1 != vertex2)) {
+        edge a;
+        a.head = vertex1;
+        a.tail = vertex2;
+        proposal.push_back(a);
+    }
+}
+
+template void AbstractGraph::proposeEdge<false>(int vertex1, int vertex2);
+template void AbstractGraph::proposeEdge<true>(int vertex1, int vertex2);
+
+/**
+ * Delete all edges of the given vertex. The removed edges are appended to the journal.
  *
  * @param vertex the index of the given vertex.
  */
-void AbstractGraph::insertEdgesRandom(int vertex) {
-    if (isDigraph) {
-        for (int i = 0; i < numberOfVertices; i++) {
-            // insert outgoing edge
-            if (mustInsertEdge(vertex, i)) {
-                AbstractGraph::addEdgeDigraph(vertex, i);
+void AbstractGraph::removeAllEdgesOfVertex(int vertex) {
+    largestComponentSize = -1;
+    componentsLabeled = false;
+    twoCoreSize = -1;
+    numberOfFormerNeighbors = 0;
+    if (storageType == ADJACENCYLIST) {
+        // just visit the neighbors of the vertex, removing from the back keeps the arrays compact
+        while (adjacencyList->getDegree(vertex) > 0) {
+            int j = adjacencyList->getNeighbor(vertex, adjacencyList->getDegree(vertex) - 1);
+            AbstractGraph::recordRemovedEdge(vertex, j, j);
+            adjacencyList->removeEdge(vertex, j);
+        }
+        if (isDigraph) {
+            while (adjacencyList->getInDegree(vertex) > 0) {
+                int j = adjacencyList->getInNeighbor(vertex, adjacencyList->getInDegree(vertex) - 1);
+                AbstractGraph::recordRemovedEdge(j, vertex, j);
+                adjacencyList->removeEdge(j, vertex);
             }
-            // insert ingoing edge
-            if (mustInsertEdge(i, vertex)) {
-                AbstractGraph::addEdgeDigraph(i, vertex);
+        }
+    } else if (storageType == BITMATRIX) {
+        // collect the edges by scanning the rows word by word, then clear them word-wide
+        int j;
+        for (j = bitMatrix->nextNeighbor(vertex, 0); j != -1; j = bitMatrix->nextNeighbor(vertex, j + 1)) {
+            AbstractGraph::recordRemovedEdge(vertex, j, j);
+        }
+        if (isDigraph) {
+            for (j = bitMatrix->nextInNeighbor(vertex, 0); j != -1; j = bitMatrix->nextInNeighbor(vertex, j + 1)) {
+                if (j != vertex) {
+                    // a loop has already been collected as outgoing edge
+                    AbstractGraph::recordRemovedEdge(j, vertex, j);
+                }
             }
         }
+        bitMatrix->clearVertex(vertex);
     } else {
         for (int i = 0; i < numberOfVertices; i++) {
-            // just one insertion is required
-            if (mustInsertEdge(vertex, i)) {
-                AbstractGraph::addEdgeNonDigraph(vertex, i);
+            if (adjacencyMatrix[vertex][i]) {
+                AbstractGraph::recordRemovedEdge(vertex, i, i);
+                adjacencyMatrix[vertex][i] = false;
+            }
+            if (adjacencyMatrix[i][vertex]) {
+                AbstractGraph::recordRemovedEdge(i, vertex, i);
+                adjacencyMatrix[i][vertex] = false;
             }
         }
     }
+    if (componentTracker != NULL) {
+        AbstractGraph::splitComponent(vertex);
+    }
 }
 
 /**
- * Delete all edges of the given vertex.
+ * Count the given edge in the degrees of both vertices, loops are not counted.
  *
- * @param vertex the index of the given vertex.
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ */
+void AbstractGraph::addDegree(int vertex1, int vertex2) {
+    if (vertex1 != vertex2) {
+        // a vertex, whose degree has been zero, is not isolated anymore
+        numberOfIsolatedVertices -= (degree[vertex1] == 0) + (degree[vertex2] == 0);
+        degree[vertex1]++;
+        degree[vertex2]++;
+    }
+}
+
+/**
+ * Append the given removed edge to the journal and update the number of edges
+ * and the degrees.
+ * If the components are tracked, the neighbor is saved as well or the edge is
+ * removed from the dynamic connectivity structure.
  *
- * @return stack with all indices of removed edges.
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ * @param neighbor the index of the vertex of the edge, whose edges are not removed.
  */
-std::stack<edge> AbstractGraph::removeAllEdgesOfVertex(int vertex) {
-    std::stack<edge> stack;
-    largestComponentSize = -1;
-    int i;
-    for (i = 0; i < numberOfVertices; i++) {
-        if (adjacencyMatrix[vertex][i]) {
-            edge a;
-            a.head = vertex;
-            a.tail = i;
-            stack.push(a);
-            adjacencyMatrix[vertex][i] = false;
-            numberOfEdges--;
-        }
-        if (adjacencyMatrix[i][vertex]) {
-            edge a;
-            a.head = i;
-            a.tail = vertex;
-            stack.push(a);
-            adjacencyMatrix[i][vertex] = false;
-            numberOfEdges--;
-        }
+void AbstractGraph::recordRemovedEdge(int vertex1, int vertex2, int neighbor) {
+    edge a;
+    a.head = vertex1;
+    a.tail = vertex2;
+    journal.push_back(a);
+    numberOfEdges--;
+    if (vertex1 != vertex2) {
+        degree[vertex1]--;
+        degree[vertex2]--;
+        // a vertex, whose degree has become zero, is isolated now
+        numberOfIsolatedVertices += (degree[vertex1] == 0) + (degree[vertex2] == 0);
+    }
+    if (dynamicConnectivity != NULL) {
+        dynamicConnectivity->removeEdge(vertex1, vertex2);
+    }
+    if ((componentTracker != NULL) && (vertex1 != vertex2)) {
+        formerNeighbors[numberOfFormerNeighbors] = neighbor;
+        numberOfFormerNeighbors++;
     }
-    return(stack);
 }
 
 /**
@@ -373,46 +756,296 @@ std::stack<edge> AbstractGraph::removeAllEdgesOfVertex(int vertex) {
  */
 void AbstractGraph::addEdge(int vertex1, int vertex2) {
     if (isDigraph) {
-        AbstractGraph::addEdgeDigraph(vertex1, vertex2);
+        if (loopsEnabled) {
+            AbstractGraph::insertEdge<true, true>(vertex1, vertex2);
+        } else {
+            AbstractGraph::insertEdge<true, false>(vertex1, vertex2);
+        }
     } else {
-        AbstractGraph::addEdgeNonDigraph(vertex1, vertex2);
+        if (loopsEnabled) {
+            AbstractGraph::insertEdge<false, true>(vertex1, vertex2);
+        } else {
+            AbstractGraph::insertEdge<false, false>(vertex1, vertex2);
+        }
     }
 }
 
 /**
- * Add the given edge to the digraph, if possible.
+ * Add the given edge to the graph, if possible.
+ *
+ * @tparam digraph true: digraph, false: no digraph, must equal isDigraph.
+ * @tparam loops true: loops enabled, false: loops disabled, must equal loopsEnabled.
  *
  * @param vertex1 index of the first vertex.
  * @param vertex2 index of the second vertex.
-*/
-void AbstractGraph::addEdgeDigraph(int vertex1, int vertex2) {
+ */
+template <bool digraph, bool loops>
+void AbstractGraph::insertEdge(int vertex1, int vertex2) {
     largestComponentSize = -1;
-    if ((!adjacencyMatrix[vertex1][vertex2]) && ((!loopsEnabled && (vertex1 != vertex2)) || loopsEnabled)) {
-        adjacencyMatrix[vertex1][vertex2] = true;
+    componentsLabeled = false;
+    twoCoreSize = -1;
+    // in case of an non digraph, where the edge has no direction, it is just inserted once
+    // (hasEdge and storeEdge follow the convention: first index is bigger than second)
+    if ((loops || (vertex1 != vertex2)) && !AbstractGraph::hasEdge<digraph>(vertex1, vertex2)) {
+        AbstractGraph::storeEdge<digraph>(vertex1, vertex2);
+        AbstractGraph::addDegree(vertex1, vertex2);
         numberOfEdges++;
     }
 }
 
+template void AbstractGraph::insertEdge<false, false>(int vertex1, int vertex2);
+template void AbstractGraph::insertEdge<false, true>(int vertex1, int vertex2);
+template void AbstractGraph::insertEdge<true, false>(int vertex1, int vertex2);
+template void AbstractGraph::insertEdge<true, true>(int vertex1, int vertex2);
+
 /**
- * Add the given edge to the undirected graph, if possible.
+ * Test whether the edge (vertex1, vertex2) is stored.
+ * For undirected graphs the order of the vertices does not matter.
  *
  * @param vertex1 index of the first vertex.
  * @param vertex2 index of the second vertex.
+ *
+ * @return true: the edge exists, false: otherwise.
  */
-void AbstractGraph::addEdgeNonDigraph(int vertex1, int vertex2) {
-    largestComponentSize = -1;
-    // in case of an non digraph, where the edge has no direction, it is just inserted once
-    if ((vertex1 > vertex2) && !adjacencyMatrix[vertex1][vertex2]) {
-        // convention: first index is bigger than second
-        adjacencyMatrix[vertex1][vertex2] = true;
-        numberOfEdges++;
-    } else if ((vertex1 < vertex2) && !adjacencyMatrix[vertex2][vertex1]) {
-        // convention: first index is bigger than second
-        adjacencyMatrix[vertex2][vertex1] = true;
-        numberOfEdges++;
-    } else if ((vertex1 == vertex2) && !adjacencyMatrix[vertex1][vertex1] && loopsEnabled) {
-        adjacencyMatrix[vertex1][vertex1] = true;
-        numberOfEdges++;
+bool AbstractGraph::hasEdge(int vertex1, int vertex2) {
+    if (isDigraph) {
+        return(AbstractGraph::hasEdge<true>(vertex1, vertex2));
+    } else {
+        return(AbstractGraph::hasEdge<false>(vertex1, vertex2));
+    }
+}
+
+/**
+ * Test whether the edge (vertex1, vertex2) is stored.
+ * For undirected graphs the order of the vertices does not matter.
+ *
+ * @tparam digraph true: digraph, false: no digraph, must equal isDigraph.
+ *
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ *
+ * @return true: the edge exists, false: otherwise.
+ */
+template <bool digraph>
+bool AbstractGraph::hasEdge(int vertex1, int vertex2) {
+    if (storageType == ADJACENCYLIST) {
+        return(adjacencyList->hasEdge(vertex1, vertex2));
+    }
+    if (storageType == BITMATRIX) {
+        return(bitMatrix->hasEdge(vertex1, vertex2));
+    }
+    // convention: first index is bigger than second, which is a conditional move
+    int row = (digraph || (vertex1 >= vertex2)) ? vertex1 : vertex2;
+    int column = (digraph || (vertex1 >= vertex2)) ? vertex2 : vertex1;
+    return(adjacencyMatrix[row][column]);
+}
+
+/**
+ * Store the edge (vertex1, vertex2), which must not exist yet.
+ * This function does not update the number of edges, but the tracked components.
+ *
+ * @tparam digraph true: digraph, false: no digraph, must equal isDigraph.
+ *
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ */
+template <bool digraph>
+void AbstractGraph::storeEdge(int vertex1, int vertex2) {
+    if (componentTracker != NULL) {
+        // inserting an edge can only merge components
+        componentTracker->merge(vertex1, vertex2);
+    }
+    if (dynamicConnectivity != NULL) {
+        dynamicConnectivity->insertEdge(vertex1, vertex2);
+    }
+    if (storageType == ADJACENCYLIST) {
+        adjacencyList->addEdge(vertex1, vertex2);
+    } else if (storageType == BITMATRIX) {
+        bitMatrix->addEdge(vertex1, vertex2);
+    } else {
+        // convention: first index is bigger than second, which is a conditional move
+        int row = (digraph || (vertex1 >= vertex2)) ? vertex1 : vertex2;
+        int column = (digraph || (vertex1 >= vertex2)) ? vertex2 : vertex1;
+        adjacencyMatrix[row][column] = true;
+    }
+}
+
+/******************* tracking of the components *******************/
+
+/**
+ * Return the next (outgoing) neighbor of the given vertex.
+ *
+ * @param vertex index of the given vertex.
+ * @param position pointer to the position, where the search continues. It must be zero
+ *       for the first call and is updated by this function.
+ *
+ * @return the index of the neighbor or -1, if all neighbors have been visited.
+ */
+int AbstractGraph::nextNeighbor(int vertex, int *position) {
+    int j;
+    if (storageType == ADJACENCYLIST) {
+        if (*position < adjacencyList->getDegree(vertex)) {
+            j = adjacencyList->getNeighbor(vertex, *position);
+            (*position)++;
+            return(j);
+        }
+        return(-1);
+    }
+    if (storageType == BITMATRIX) {
+        j = bitMatrix->nextNeighbor(vertex, *position);
+        *position = (j == -1) ? numberOfVertices : j + 1;
+        return(j);
+    }
+    for (j = *position; j < numberOfVertices; j++) {
+        if (AbstractGraph::hasEdge(vertex, j)) {
+            *position = j + 1;
+            return(j);
+        }
+    }
+    *position = numberOfVertices;
+    return(-1);
+}
+
+/**
+ * Start a new local search, afterwards no vertex is visited.
+ * This costs O(1) instead of O(N) for resetting an array of marks.
+ */
+void AbstractGraph::startVisit() {
+    visitStamp++;
+    if (visitStamp == INT_MAX) {
+        // avoid an overflow of the stamp
+        for (int i = 0; i < numberOfVertices; i++) {
+            visited[i] = 0;
+        }
+        visitStamp = 1;
+    }
+}
+
+/**
+ * Return the group of the given search. Searches, which have met each other,
+ * belong to the same group, because they explore the same part.
+ *
+ * @param search, the index of the given search.
+ *
+ * @return the index of the group.
+ */
+int AbstractGraph::findGroup(int search) {
+    while (searchGroup[search] != search) {
+        searchGroup[search] = searchGroup[searchGroup[search]];
+        search = searchGroup[search];
+    }
+    return(search);
+}
+
+/**
+ * Update the tracked components after all edges of the given vertex have been removed.
+ * Only the former component of the vertex is explored again: one depth-first search
+ * starts at each former neighbor and all searches proceed in turns. Searches, which meet
+ * each other, are merged. A group of searches, whose stacks are empty, has found
+ * a complete part, which becomes a new component. The exploration stops as soon as only
+ * one group is left, this remaining part keeps the former component. Hence the costs
+ * are bounded by the number of searches times the size of the smaller parts.
+ *
+ * @param vertex, the index of the given vertex.
+ */
+void AbstractGraph::splitComponent(int vertex) {
+    if (numberOfFormerNeighbors == 0) {
+        // the vertex has already been isolated
+        return;
+    }
+    int i, search, group, other, current, next, start, end;
+    int numberOfSearches = 0;
+    int numberOfVisited = 0;
+    componentTracker->isolate(vertex);
+    AbstractGraph::startVisit();
+    visited[vertex] = visitStamp;
+    // each part of the former component contains at least one former neighbor
+    for (i = 0; i < numberOfFormerNeighbors; i++) {
+        current = formerNeighbors[i];
+        if (visited[current] == visitStamp) {
+            continue;
+        }
+        visited[current] = visitStamp;
+        searchPosition[current] = 0;
+        searchOwner[current] = numberOfSearches;
+        visitOrder[numberOfVisited] = current;
+        numberOfVisited++;
+        searchStacks[numberOfSearches].clear();
+        searchStacks[numberOfSearches].push_back(current);
+        searchGroup[numberOfSearches] = numberOfSearches;
+        openSearches[numberOfSearches] = 1;
+        numberOfSearches++;
+    }
+    int unfinishedGroups = numberOfSearches;
+    while (unfinishedGroups > 1) {
+        for (search = 0; (search < numberOfSearches) && (unfinishedGroups > 1); search++) {
+            if (searchStacks[search].empty()) {
+                continue;
+            }
+            current = searchStacks[search].back();
+            next = AbstractGraph::nextNeighbor(current, &searchPosition[current]);
+            if (next == -1) {
+                searchStacks[search].pop_back();
+                if (searchStacks[search].empty()) {
+                    group = AbstractGraph::findGroup(search);
+                    openSearches[group]--;
+                    if (openSearches[group] == 0) {
+                        // the group has found a complete part
+                        unfinishedGroups--;
+                    }
+                }
+            } else if (visited[next] != visitStamp) {
+                visited[next] = visitStamp;
+                searchPosition[next] = 0;
+                searchOwner[next] = search;
+                visitOrder[numberOfVisited] = next;
+                numberOfVisited++;
+                searchStacks[search].push_back(next);
+            } else {
+                // a finished group can not be reached, hence both groups are unfinished
+                group = AbstractGraph::findGroup(search);
+                other = AbstractGraph::findGroup(searchOwner[next]);
+                if (group != other) {
+                    searchGroup[other] = group;
+                    openSearches[group] += openSearches[other];
+                    unfinishedGroups--;
+                }
+            }
+        }
+    }
+    if (numberOfSearches == 1) {
+        return;
+    }
+    // sort the vertices of the finished groups by their group, searchPosition is used as counter
+    for (search = 0; search < numberOfSearches; search++) {
+        searchPosition[search] = 0;
+    }
+    for (i = 0; i < numberOfVisited; i++) {
+        group = AbstractGraph::findGroup(searchOwner[visitOrder[i]]);
+        if (openSearches[group] == 0) {
+            searchPosition[group]++;
+        }
+    }
+    end = 0;
+    for (search = 0; search < numberOfSearches; search++) {
+        start = end;
+        end += searchPosition[search];
+        searchPosition[search] = start;
+    }
+    for (i = 0; i < numberOfVisited; i++) {
+        group = AbstractGraph::findGroup(searchOwner[visitOrder[i]]);
+        if (openSearches[group] == 0) {
+            pieceVertices[searchPosition[group]] = visitOrder[i];
+            searchPosition[group]++;
+        }
+    }
+    // each finished group becomes a new component, the remaining part keeps the former one
+    start = 0;
+    for (search = 0; search < numberOfSearches; search++) {
+        if ((AbstractGraph::findGroup(search) == search) && (openSearches[search] == 0)) {
+            componentTracker->separate(&pieceVertices[start], searchPosition[search] - start);
+            start = searchPosition[search];
+        }
     }
 }
 
@@ -435,8 +1068,50 @@ void AbstractGraph::saveGraphToGraphviz(const std::string directory, const std::
         outfile << "graph G {" << std::endl;
     }
     // write all edges to file
-    for (int i = 0; i < numberOfVertices; i++) {
-        for (int j = 0; j < numberOfVertices; j++) {
+    AbstractGraph::writeEdgesToGraphviz(outfile);
+    // write tail of graphviz representation to file
+    outfile << "}" << std::endl;
+    // close the file
+    outfile.close();
+}
+
+/**
+ * Write all edges of the graph in graphviz format to the given file.
+ *
+ * @param outfile, reference to the opened graphviz file.
+ */
+void AbstractGraph::writeEdgesToGraphviz(std::ofstream& outfile) {
+    int i, j, k;
+    if (storageType == ADJACENCYLIST) {
+        // O(N + M): visit the neighbors of each vertex
+        for (i = 0; i < numberOfVertices; i++) {
+            for (k = 0; k < adjacencyList->getDegree(i); k++) {
+                j = adjacencyList->getNeighbor(i, k);
+                if (isDigraph) {
+                    outfile << i << " -> " << j << std::endl;
+                } else if (i >= j) {
+                    // each undirected edge is stored twice, write it once
+                    outfile << i << " -- " << j << std::endl;
+                }
+            }
+        }
+        return;
+    }
+    if (storageType == BITMATRIX) {
+        for (i = 0; i < numberOfVertices; i++) {
+            for (j = bitMatrix->nextNeighbor(i, 0); j != -1; j = bitMatrix->nextNeighbor(i, j + 1)) {
+                if (isDigraph) {
+                    outfile << i << " -> " << j << std::endl;
+                } else if (i >= j) {
+                    // the matrix is symmetric, write each edge once
+                    outfile << i << " -- " << j << std::endl;
+                }
+            }
+        }
+        return;
+    }
+    for (i = 0; i < numberOfVertices; i++) {
+        for (j = 0; j < numberOfVertices; j++) {
             if (adjacencyMatrix[i][j]) {
                 if (isDigraph) {
                     outfile << i << " -> " << j << std::endl;
@@ -446,30 +1121,47 @@ void AbstractGraph::saveGraphToGraphviz(const std::string directory, const std::
             }
         }
     }
-    // write tail of graphviz representation to file
-    outfile << "}" << std::endl;
-    // close the file
-    outfile.close();
 }
 
 /******************* calculation of the size of largest components *******************/
 
 /**
- * Calculate the size of the largest component using a depth-first search algorithm.
+ * Calculate the size of the largest component, the number of components and the labels
+ * and the sizes of the components using a depth-first search algorithm, also if the
+ * components are tracked, because the tracking structures do not provide the labels.
+ * The weakly or strongly connected components of a digraph are calculated
+ * by weakComponents or strongComponents.
  */
 void AbstractGraph::sizeOfLargestComponent() {
-    // declare all variables
-    std::stack<int> stack;
-    int counter, startVertex, current, numberOfMarkedVertices;
-    bool marked[numberOfVertices];
+    componentsLabeled = true;
+    // the histogram is only counted on request, because it costs O(N) per pass
+    componentSizesCounted = false;
+    // an applied candidate graph overwrites the labels of the previous graph
+    journalComponentsLabeled = false;
+    if (digraphComponentType == WEAKCOMPONENTS) {
+        AbstractGraph::weakComponents();
+        return;
+    } else if (digraphComponentType == STRONGCOMPONENTS) {
+        AbstractGraph::strongComponents();
+        return;
+    }
+    // declare all variables, the stack is preallocated
+    int counter, startVertex, current, numberOfMarkedVertices, stackSize;
     // initialize variables
     numberOfMarkedVertices = 0;
     startVertex = 0;
     for (int i = 0; i < numberOfVertices; i++) {
         marked[i] = false;
+        searchPosition[i] = 0;
+    }
+    if (storageType == BITMATRIX) {
+        for (int i = 0; i < bitMatrix->getWordsPerRow(); i++) {
+            markedBits[i] = 0;
+        }
     }
 
     numberOfComponents = 0;
+    largestComponentSize = 0;
 
     while (numberOfMarkedVertices < numberOfVertices) {
         // find current start vertex
@@ -484,65 +1176,441 @@ void AbstractGraph::sizeOfLargestComponent() {
         current = startVertex;
         counter = 1;
         numberOfComponents++;
-        stack.push(current);
+        searchStack[0] = current;
+        stackSize = 1;
         marked[current] = true;
+        componentLabel[current] = numberOfComponents - 1;
+        if (storageType == BITMATRIX) {
+            markedBits[current >> 6] |= (1ULL << (current & 63));
+        }
         numberOfMarkedVertices++;
-        while (!stack.empty()) {
-            current = unmarkedVertex(current, marked);
+        while (stackSize > 0) {
+            current = unmarkedVertex(current, marked, searchPosition);
             // current contains an index to an unmarked vertex or -1,
             // if no such vertex exists
             if (current != -1) {
                 // found an unmarked vertex
                 marked[current] = true;
+                componentLabel[current] = numberOfComponents - 1;
+                if (storageType == BITMATRIX) {
+                    markedBits[current >> 6] |= (1ULL << (current & 63));
+                }
                 numberOfMarkedVertices++;
-                stack.push(current);
+                searchStack[stackSize] = current;
+                stackSize++;
                 counter++;
             } else {
+                stackSize--;
+                if (stackSize > 0) {
+                    current = searchStack[stackSize - 1];
+                }
+            }
+        }
+        componentSize[numberOfComponents - 1] = counter;
+        if (counter > largestComponentSize) {
+            largestComponentSize = counter;
+        }
+    }
+}
+
+/**
+ * Calculate the weakly connected components of the digraph by a union-find
+ * over all edges, which costs O(N + M) (list) or O(N^2) (matrix).
+ */
+void AbstractGraph::weakComponents() {
+    int i, j, position, root1, root2;
+    for (i = 0; i < numberOfVertices; i++) {
+        unionParent[i] = i;
+        unionSize[i] = 1;
+    }
+    numberOfComponents = numberOfVertices;
+    largestComponentSize = (numberOfVertices > 0) ? 1 : 0;
+    for (i = 0; i < numberOfVertices; i++) {
+        // the outgoing edges contain each edge once
+        position = 0;
+        for (j = AbstractGraph::nextNeighbor(i, &position); j != -1; j = AbstractGraph::nextNeighbor(i, &position)) {
+            root1 = AbstractGraph::findUnionRoot(i);
+            root2 = AbstractGraph::findUnionRoot(j);
+            if (root1 == root2) {
+                continue;
+            }
+            // union by size: hang the smaller tree below the bigger one
+            if (unionSize[root1] < unionSize[root2]) {
+                unionParent[root1] = root2;
+                unionSize[root2] = unionSize[root2] + unionSize[root1];
+                root1 = root2;
+            } else {
+                unionParent[root2] = root1;
+                unionSize[root1] = unionSize[root1] + unionSize[root2];
+            }
+            numberOfComponents--;
+            if (unionSize[root1] > largestComponentSize) {
+                largestComponentSize = unionSize[root1];
+            }
+        }
+    }
+    // number the roots first, then each vertex takes the label of its root
+    root1 = 0;
+    for (i = 0; i < numberOfVertices; i++) {
+        if (unionParent[i] == i) {
+            componentLabel[i] = root1;
+            componentSize[root1] = unionSize[i];
+            root1++;
+        }
+    }
+    for (i = 0; i < numberOfVertices; i++) {
+        componentLabel[i] = componentLabel[AbstractGraph::findUnionRoot(i)];
+    }
+}
+
+/**
+ * Return the root of the given vertex in the union-find of weakComponents.
+ *
+ * @param vertex index of the given vertex.
+ *
+ * @return the index of the root.
+ */
+int AbstractGraph::findUnionRoot(int vertex) {
+    // path halving
+    while (unionParent[vertex] != vertex) {
+        unionParent[vertex] = unionParent[unionParent[vertex]];
+        vertex = unionParent[vertex];
+    }
+    return(vertex);
+}
+
+/**
+ * Calculate the strongly connected components of the digraph by an iterative
+ * version of the algorithm of Tarjan, which costs O(N + M) (list) or O(N^2) (matrix).
+ * The depth-first search uses searchStack and searchPosition, marked holds the vertices
+ * on the stack of Tarjan.
+ */
+void AbstractGraph::strongComponents() {
+    int i, start, current, next, counter, parent;
+    int index = 0;
+    int stackSize = 0;
+    int tarjanSize = 0;
+    for (i = 0; i < numberOfVertices; i++) {
+        tarjanIndex[i] = -1;
+        marked[i] = false;
+        searchPosition[i] = 0;
+    }
+    numberOfComponents = 0;
+    largestComponentSize = 0;
+    for (start = 0; start < numberOfVertices; start++) {
+        if (tarjanIndex[start] != -1) {
+            continue;
+        }
+        next = start;
+        while (true) {
+            if (next != -1) {
+                // visit the vertex for the first time
+                tarjanIndex[next] = index;
+                tarjanLowLink[next] = index;
+                index++;
+                tarjanStack[tarjanSize] = next;
+                tarjanSize++;
+                marked[next] = true;
+                searchStack[stackSize] = next;
+                stackSize++;
+            }
+            current = searchStack[stackSize - 1];
+            next = AbstractGraph::nextNeighbor(current, &searchPosition[current]);
+            if (next != -1) {
+                if (tarjanIndex[next] != -1) {
+                    if (marked[next] && (tarjanIndex[next] < tarjanLowLink[current])) {
+                        // the neighbor belongs to the component of current
+                        tarjanLowLink[current] = tarjanIndex[next];
+                    }
+                    next = -1;
+                }
+                continue;
+            }
+            // all neighbors of current have been visited
+            stackSize--;
+            if (tarjanLowLink[current] == tarjanIndex[current]) {
+                // current is the root of a strongly connected component
+                counter = 0;
+                do {
+                    tarjanSize--;
+                    next = tarjanStack[tarjanSize];
+                    marked[next] = false;
+                    componentLabel[next] = numberOfComponents;
+                    counter++;
+                } while (next != current);
+                next = -1;
+                componentSize[numberOfComponents] = counter;
+                numberOfComponents++;
                 if (counter > largestComponentSize) {
                     largestComponentSize = counter;
                 }
-                stack.pop();
-                if (!stack.empty()) {
-                    current = stack.top();
+            }
+            if (stackSize == 0) {
+                break;
+            }
+            parent = searchStack[stackSize - 1];
+            if (tarjanLowLink[current] < tarjanLowLink[parent]) {
+                tarjanLowLink[parent] = tarjanLowLink[current];
+            }
+        }
+    }
+}
+
+/**
+ * Calculate the size of the 2-core by removing the vertices with less than two
+ * remaining neighbors, searchPosition holds the remaining degrees and searchStack
+ * the removed vertices, whose neighbors have not been updated yet.
+ */
+void AbstractGraph::twoCore() {
+    int i, current, next, position;
+    int stackSize = 0;
+    twoCoreSize = numberOfVertices;
+    for (i = 0; i < numberOfVertices; i++) {
+        searchPosition[i] = degree[i];
+        marked[i] = (degree[i] < 2);
+        if (marked[i]) {
+            searchStack[stackSize] = i;
+            stackSize++;
+            twoCoreSize--;
+        }
+    }
+    while (stackSize > 0) {
+        stackSize--;
+        current = searchStack[stackSize];
+        position = 0;
+        for (next = AbstractGraph::nextNeighbor(current, &position); next != -1; next = AbstractGraph::nextNeighbor(current, &position)) {
+            if (!marked[next]) {
+                // a loop is never counted, because current is marked
+                searchPosition[next]--;
+                if (searchPosition[next] < 2) {
+                    marked[next] = true;
+                    searchStack[stackSize] = next;
+                    stackSize++;
+                    twoCoreSize--;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Calculate the size of the largest component of the proposed candidate graph using
+ * a depth-first search algorithm, which replaces the stored edges of the choosen vertex
+ * by the proposed ones. The components of an undirected graph do not depend on the order
+ * of the start vertices, hence the component of the choosen vertex is searched first.
+ * Afterwards the choosen vertex is marked, such that its stored edges are never used.
+ * For digraphs the choosen vertex is hidden by a mark until it is reached.
+ * The search stops as soon as a component is bigger than the given bound or no unmarked
+ * component can be bigger than the largest one, in the latter case the number of
+ * components is unknown (-1).
+ *
+ * @param bound the maximum size, which is of interest.
+ *
+ * @return true: the size has been calculated, false: the bound has been exceeded.
+ */
+bool AbstractGraph::sizeOfLargestCandidateComponent(int bound) {
+    // declare all variables, the stack is preallocated
+    int counter, startVertex, current, next, numberOfMarkedVertices, stackSize, i;
+    int numberOfProposals = (int) proposal.size();
+    bool vertexHidden = isDigraph;
+    // initialize variables
+    numberOfMarkedVertices = 0;
+    startVertex = 0;
+    for (i = 0; i < numberOfVertices; i++) {
+        marked[i] = false;
+        searchPosition[i] = 0;
+    }
+    if (storageType == BITMATRIX) {
+        for (i = 0; i < bitMatrix->getWordsPerRow(); i++) {
+            markedBits[i] = 0;
+        }
+    }
+    if (vertexHidden) {
+        marked[candidateVertex] = true;
+        if (storageType == BITMATRIX) {
+            markedBits[candidateVertex >> 6] |= (1ULL << (candidateVertex & 63));
+        }
+        // mark the vertices, which reach the choosen vertex by a proposed edge
+        for (i = 0; i < numberOfProposals; i++) {
+            if (proposal[i].tail == candidateVertex) {
+                proposedNeighbor[proposal[i].head] = true;
+            }
+        }
+    }
+
+    candidateComponents = 0;
+    candidateLargestComponentSize = -1;
+
+    while (numberOfMarkedVertices < numberOfVertices) {
+        if (candidateLargestComponentSize >= numberOfVertices - numberOfMarkedVertices) {
+            // the remaining components are not bigger
+            candidateComponents = -1;
+            break;
+        }
+        if ((numberOfMarkedVertices == 0) && !isDigraph) {
+            current = candidateVertex;
+        } else {
+            // find current start vertex
+            while (marked[startVertex] && ((startVertex != candidateVertex) || !vertexHidden)) {
+                startVertex++;
+            }
+            current = startVertex;
+        }
+        // found a component, that has not been treated jet
+        counter = 1;
+        candidateComponents++;
+        searchStack[0] = current;
+        stackSize = 1;
+        if (current == candidateVertex) {
+            vertexHidden = false;
+        }
+        marked[current] = true;
+        if (storageType == BITMATRIX) {
+            markedBits[current >> 6] |= (1ULL << (current & 63));
+        }
+        numberOfMarkedVertices++;
+        while (stackSize > 0) {
+            if (current == candidateVertex) {
+                // just visit the proposed edges instead of the stored ones
+                next = -1;
+                while ((next == -1) && (searchPosition[current] < numberOfProposals)) {
+                    if (proposal[searchPosition[current]].head == current) {
+                        next = proposal[searchPosition[current]].tail;
+                    } else if (!isDigraph) {
+                        next = proposal[searchPosition[current]].head;
+                    }
+                    searchPosition[current]++;
+                    if ((next != -1) && marked[next]) {
+                        next = -1;
+                    }
+                }
+            } else {
+                next = unmarkedVertex(current, marked, searchPosition);
+                if ((next == -1) && vertexHidden && proposedNeighbor[current]) {
+                    // the proposed edge to the hidden vertex
+                    next = candidateVertex;
+                    vertexHidden = false;
                 }
             }
+            current = next;
+            // current contains an index to an unmarked vertex or -1,
+            // if no such vertex exists
+            if (current != -1) {
+                // found an unmarked vertex
+                marked[current] = true;
+                if (storageType == BITMATRIX) {
+                    markedBits[current >> 6] |= (1ULL << (current & 63));
+                }
+                numberOfMarkedVertices++;
+                searchStack[stackSize] = current;
+                stackSize++;
+                counter++;
+                if (counter > bound) {
+                    // the size of the largest component exceeds the bound
+                    candidateLargestComponentSize = counter;
+                    stackSize = 0;
+                    numberOfMarkedVertices = numberOfVertices;
+                }
+            } else {
+                if (counter > candidateLargestComponentSize) {
+                    candidateLargestComponentSize = counter;
+                }
+                stackSize--;
+                if (stackSize > 0) {
+                    current = searchStack[stackSize - 1];
+                }
+            }
+        }
+    }
+    if (isDigraph) {
+        for (i = 0; i < numberOfProposals; i++) {
+            proposedNeighbor[proposal[i].head] = false;
         }
     }
+    return(candidateLargestComponentSize <= bound);
 }
 
 /**
  * Find an unmarked vertex, which is the tail of an edge from the given vertex.
  * This function is an auxiliary function for calculating the size of the largest components.
+ * The search continues at position[vertex], because marked vertices never become unmarked
+ * during one search. Hence each vertex costs O(degree) (list) or O(N) (matrix) in total.
  *
  * @param vertex index of the given vertex.
  * @param marked an array of length numberOfVertices which contains informations
  *       about the visited vertices.
+ * @param position an array of length numberOfVertices which contains for each vertex
+ *       where to continue the search, must be initialized with zero.
  *
  * @return the index of an unmarked vertex of -1, if all vertices are marked.
  */
-int AbstractGraph::unmarkedVertex(int vertex, bool marked[]) {
-    for (int j = 0; j < numberOfVertices; j++) {
-        if (!marked[j]) {
-            if (isDigraph) {
-                // directed graph
-                if (adjacencyMatrix[vertex][j]) {
-                    return(j);
-                }
-            } else {
-                // undirected graph
-                if (vertex > j) {
-                    // convention: first index is bigger than second
-                    if (adjacencyMatrix[vertex][j]) {
-                        return(j);
-                    }
-                } else if (j > vertex) {
-                    // convention: first index is bigger than second
-                    if (adjacencyMatrix[j][vertex]) {
-                        return(j);
-                    }
-                }
+int AbstractGraph::unmarkedVertex(int vertex, bool marked[], int position[]) {
+    int j;
+    if (storageType == ADJACENCYLIST) {
+        // just visit the neighbors
+        for (int k = position[vertex]; k < adjacencyList->getDegree(vertex); k++) {
+            j = adjacencyList->getNeighbor(vertex, k);
+            if (!marked[j]) {
+                position[vertex] = k + 1;
+                return(j);
+            }
+        }
+        position[vertex] = adjacencyList->getDegree(vertex);
+        return(-1);
+    }
+    if (storageType == BITMATRIX) {
+        // word-level scan of row & ~marked
+        j = bitMatrix->nextUnmarkedNeighbor(vertex, markedBits, position[vertex]);
+        position[vertex] = (j == -1) ? numberOfVertices : j + 1;
+        return(j);
+    }
+    if (isDigraph) {
+        return(AbstractGraph::unmarkedMatrixVertex<true>(vertex, marked, position));
+    } else {
+        return(AbstractGraph::unmarkedMatrixVertex<false>(vertex, marked, position));
+    }
+}
+
+/**
+ * Find an unmarked vertex, which is the tail of an edge from the given vertex,
+ * in the adjacency matrix. The undirected graph stores the edges (vertex, j) with j < vertex
+ * in the row of the vertex and the edges with j > vertex in its column, hence both parts
+ * are scanned by separate loops instead of testing the convention for each j.
+ *
+ * @tparam digraph true: digraph, false: no digraph, must equal isDigraph.
+ *
+ * @param vertex index of the given vertex.
+ * @param marked an array of length numberOfVertices which contains informations
+ *       about the visited vertices.
+ * @param position an array of length numberOfVertices which contains for each vertex
+ *       where to continue the search, must be initialized with zero.
+ *
+ * @return the index of an unmarked vertex of -1, if all vertices are marked.
+ */
+template <bool digraph>
+int AbstractGraph::unmarkedMatrixVertex(int vertex, bool marked[], int position[]) {
+    int j = position[vertex];
+    const bool *row = adjacencyMatrix[vertex];
+    // a digraph uses the complete row
+    int end = digraph ? numberOfVertices : vertex;
+    for (; j < end; j++) {
+        if (row[j] && !marked[j]) {
+            position[vertex] = j + 1;
+            return(j);
+        }
+    }
+    if (!digraph) {
+        // skip the loop, it never leads to an unmarked vertex
+        if (j <= vertex) {
+            j = vertex + 1;
+        }
+        for (; j < numberOfVertices; j++) {
+            if (adjacencyMatrix[j][vertex] && !marked[j]) {
+                position[vertex] = j + 1;
+                return(j);
             }
         }
     }
+    position[vertex] = numberOfVertices;
     return(-1);
 }
@@ -22,16 +22,51 @@
 #define ABSTRACTGRAPH_H_INCLUDED
 
 #include <fstream>
-#include <stack>
+#include <limits.h>
+#include <vector>
 
+#include "adjacencyList.h"
+#include "bitMatrix.h"
+#include "componentTracker.h"
+#include "dynamicConnectivity.h"
 #include "edge.h"
-#include "previousState.h"
 #include "randomGenerator.h"
+#include "strNumConv.h"
+
+/**
+ * Define some usefull makros for choosing the storage of the edges.
+ */
+#define ADJACENCYMATRIX 0
+#define ADJACENCYLIST 1
+#define BITMATRIX 2
+
+/**
+ * Define some usefull makros for choosing how the components are obtained.
+ */
+#define COMPONENTSEARCH 0
+#define COMPONENTTRACKING 1
+#define DYNAMICCONNECTIVITY 2
+
+/**
+ * Define some usefull makros for choosing the components of a digraph.
+ * REACHABLECOMPONENTS are the vertices reachable from the unmarked start vertices,
+ * hence they depend on the order of the vertices.
+ */
+#define REACHABLECOMPONENTS 0
+#define WEAKCOMPONENTS 1
+#define STRONGCOMPONENTS 2
 
 /**
  * Define an abstract graph representation.
  * This class can handle both directed- and undirected graphs.
  * Furthermore loops can be either enabled of disabled.
+ * The edges are either stored in an adjacency matrix (O(N^2) memory),
+ * in an adjacency list (O(N + M) memory) or in a bit-packed adjacency matrix
+ * (O(N^2 / 8) memory), which is choosen at construction time.
+ * The components are either calculated by a depth-first search after each change,
+ * tracked incrementally or kept by a fully dynamic connectivity structure
+ * (both undirected graphs only). The components of a digraph are either the reachable,
+ * the weakly or the strongly connected ones.
  */
 class AbstractGraph {
 public:
@@ -42,9 +77,15 @@ public:
      * @param generator a random number generator.
      * @param digraph true (default): digraph, false: no digraph.
      * @param loopsAllowed true (default): loops enabled, false: loops disabled.
+     * @param storage ADJACENCYMATRIX (default), ADJACENCYLIST or BITMATRIX.
+     * @param components COMPONENTSEARCH (default), COMPONENTTRACKING or DYNAMICCONNECTIVITY.
+     * @param digraphComponents REACHABLECOMPONENTS (default), WEAKCOMPONENTS or STRONGCOMPONENTS,
+     *       ignored for undirected graphs.
      */
     AbstractGraph(int n, RandomGenerator* generator,
-                  bool digraph = false, bool loopsAllowed = false);
+                  bool digraph = false, bool loopsAllowed = false,
+                  int storage = ADJACENCYMATRIX, int components = COMPONENTSEARCH,
+                  int digraphComponents = REACHABLECOMPONENTS);
 
     /**
      * Destructor.
@@ -52,7 +93,7 @@ public:
     virtual ~AbstractGraph();
 
     /**
-     * Set all elements of the adjacency matrix to false.
+     * Remove all edges of the graph.
      */
     void resetGraph();
 
@@ -78,19 +119,50 @@ public:
 
     /**
      * Generate a graph with randomly set edges.
+     * This function is abstract and must be implemented by inheriting classes.
      */
-    void generateRandom();
+    virtual void generateRandom() = 0;
 
     /**
-     * Generate a candidate graph, where one vertex is choosen randomly. After removing
-     * all edges of this vertex, one inserts all feasible edges with a certain probability.
+     * Propose a candidate graph, where one vertex is choosen randomly. All edges of this
+     * vertex are replaced by feasible edges, which are drawn with a certain probability.
+     * The proposed edges are only saved, the graph is not changed.
      *
-     * @param vertex, pointer to a vertex, which will contain the choosen vertex after
-     *       calling this function.
+     * @return the index of the choosen vertex.
+     */
+    int proposeCandidateGraph();
+
+    /**
+     * Return the size of the largest component of the proposed candidate graph.
+     * If the components are searched, the candidate graph is explored without changing
+     * the graph, the search stops as soon as a component is bigger than the given bound.
+     * If the components are tracked or the weakly or strongly connected components of
+     * a digraph are used, the candidate graph is applied and the
+     * previous state is saved in the undo journal of the graph.
+     *
+     * @param bound the maximum size, which is of interest (default: no bound).
      *
-     * @return a backup of the current state.
+     * @return the size of the largest component of the candidate graph
+     *       or a value bigger than the bound.
+     */
+    int evaluateCandidateGraph(int bound = INT_MAX);
+
+    /**
+     * Apply the proposed candidate graph, if it has not been applied yet. The removed edges
+     * and the previous counts are saved in the undo journal, such that rejectCandidateGraph
+     * can restore the previous state.
+     */
+    void applyCandidateGraph();
+
+    /**
+     * Accept the proposed candidate graph, such that it becomes the current graph.
+     */
+    void acceptCandidateGraph();
+
+    /**
+     * Reject the proposed candidate graph, such that the current graph is kept.
      */
-    previousState generateCandidateGraph(int* vertex);
+    void rejectCandidateGraph();
 
     /**
      * This function returns the size of the largest component. Maybe the size must be
@@ -108,6 +180,37 @@ public:
      */
     int getNumberOfComponents();
 
+    /**
+     * Return the label of the component of the given vertex. The labels are numbered
+     * from zero to getNumberOfComponents() - 1. The labels and sizes are produced by one
+     * component pass, the histogram of the sizes is counted from them on request. All of
+     * them stay valid until the graph is changed, afterwards the next request repeats the pass.
+     *
+     * @param vertex the index of the given vertex.
+     *
+     * @return the label of the component.
+     */
+    int getComponentOfVertex(int vertex);
+
+    /**
+     * Return the size of the component with the given label.
+     *
+     * @param component the label of the component.
+     *
+     * @return the size of the component.
+     */
+    int getSizeOfComponent(int component);
+
+    /**
+     * Return how many components have the given size. If the components are tracked,
+     * the sizes are taken from the tracking structure without a component pass.
+     *
+     * @param size the size of the components, between 0 and numberOfVertices.
+     *
+     * @return the number of components of the given size.
+     */
+    int getNumberOfComponentsOfSize(int size);
+
     /**
      * Return the number of edges of the graph.
      *
@@ -115,6 +218,24 @@ public:
      */
     int getNumberOfEdges();
 
+    /**
+     * Return the number of vertices without an edge to another vertex, loops are ignored.
+     * The degrees are updated by each change of an edge, hence this costs O(1).
+     *
+     * @return the number of isolated vertices.
+     */
+    int getNumberOfIsolatedVertices();
+
+    /**
+     * Return the size of the 2-core, which is the largest subgraph, whose vertices have
+     * at least two neighbors in the subgraph. It is calculated by removing the vertices
+     * with less than two remaining neighbors in O(N + M) (list) or O(N^2) (matrix)
+     * and stays valid until the graph is changed. Loops are ignored. Undirected graphs only.
+     *
+     * @return the number of vertices of the 2-core.
+     */
+    int getSizeOfTwoCore();
+
     /**
      * Return the number of vertices of the graph.
      *
@@ -124,6 +245,7 @@ public:
 
     /**
      * Return the entry of the adjacency matrix for the given vertices.
+     * For undirected graphs the entry is symmetric.
      *
      * @param vertex1 the index of the first vertex.
      * @param vertex2 the index of the second vertex.
@@ -132,6 +254,13 @@ public:
      */
     int getAdjacencyMatrixEntry(int vertex1, int vertex2);
 
+    /**
+     * Return how the edges are stored.
+     *
+     * @return ADJACENCYMATRIX, ADJACENCYLIST or BITMATRIX.
+     */
+    int getStorage();
+
     /**
      * Return whether the graph is directed (true) or undirected (false).
      *
@@ -153,15 +282,6 @@ public:
      */
     RandomGenerator* getRandomGenerator();
 
-    /**
-     * Revert the step graph => candidate. Remove all edges of the given
-     * vertex and add all old ones.
-     *
-     * @param vertex, the index of the given vertex.
-     * @param safedState, backup of the previous state.
-     */
-    void revertGenerateCandidateGraph(int vertex, previousState safedState);
-
     /**
      * This function inserts one edge randomly into the graph.
      */
@@ -169,87 +289,309 @@ public:
 
 protected:
     bool **adjacencyMatrix;
+    AdjacencyList *adjacencyList;
+    BitMatrix *bitMatrix;
     bool isDigraph;
     RandomGenerator *randomGenerator;
 
     /**
-     * Should the edge (vertex1, vertex2) be inserted?
+     * Write all edges of the graph in graphviz format to the given file.
+     *
+     * @param outfile, reference to the opened graphviz file.
+     */
+    void writeEdgesToGraphviz(std::ofstream& outfile);
+
+    /**
+     * This function proposes for the given index all feasible edges with
+     * a certain probability by calling proposeEdge.
      * This function is abstract and must be implemented by inheriting classes.
      *
-     * @param vertex1 index of the head of the proposed edge.
-     * @param vertex2 index of the target of the propose edge.
+     * @param vertex the index of the given vertex.
+     */
+    virtual void proposeEdgesRandom(int vertex) = 0;
+
+    /**
+     * Append the given edge to the proposed edges of the candidate graph, if possible.
+     * The kernel is specialized for the flag at compile time, such that the sampling
+     * loops decide about it once instead of for each edge.
+     *
+     * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled().
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     */
+    template <bool loops>
+    void proposeEdge(int vertex1, int vertex2);
+
+    /**
+     * Add the given edge to the graph, if possible. The kernel is specialized for
+     * both flags at compile time, such that the sampling loops decide about them once
+     * instead of for each edge.
      *
-     * @return true: insert the proposed edge;
-     *    false: do not insert the proposed edge.
+     * @tparam digraph true: digraph, false: no digraph, must equal isDigraph.
+     * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled().
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
      */
-    virtual bool mustInsertEdge(int vertex1, int vertex2) = 0;
+    template <bool digraph, bool loops>
+    void insertEdge(int vertex1, int vertex2);
 
 private:
     int numberOfVertices;
     int numberOfEdges;
+    int *degree;
+    int numberOfIsolatedVertices;
+    int twoCoreSize;
     int largestComponentSize;
     int numberOfComponents;
+    int digraphComponentType;
     bool loopsEnabled;
+    int storageType;
+    bool *marked;
+    uint64_t *markedBits;
+    int *searchPosition;
+    int *searchStack;
+    int *unionParent;
+    int *unionSize;
+    int *tarjanIndex;
+    int *tarjanLowLink;
+    int *tarjanStack;
+    int *componentLabel;
+    int *componentSize;
+    int *componentSizeCounter;
+    bool componentsLabeled;
+    bool componentSizesCounted;
+    ComponentTracker *componentTracker;
+    DynamicConnectivity *dynamicConnectivity;
+    int *formerNeighbors;
+    int numberOfFormerNeighbors;
+    std::vector<int> *searchStacks;
+    int *searchOwner;
+    int *searchGroup;
+    int *openSearches;
+    int *visitOrder;
+    int *pieceVertices;
+    int *visited;
+    int visitStamp;
+    std::vector<edge> proposal;
+    bool *proposedNeighbor;
+    int candidateVertex;
+    bool candidateApplied;
+    bool candidateEvaluated;
+    int candidateComponents;
+    int candidateLargestComponentSize;
+    std::vector<edge> journal;
+    int journalEdges;
+    int journalComponents;
+    int journalLargestComponentSize;
+    int journalTwoCoreSize;
+    bool journalComponentsLabeled;
+
+    /**
+     * Test whether the edge (vertex1, vertex2) is stored.
+     * For undirected graphs the order of the vertices does not matter.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     *
+     * @return true: the edge exists, false: otherwise.
+     */
+    bool hasEdge(int vertex1, int vertex2);
+
+    /**
+     * Test whether the edge (vertex1, vertex2) is stored.
+     * For undirected graphs the order of the vertices does not matter.
+     *
+     * @tparam digraph true: digraph, false: no digraph, must equal isDigraph.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     *
+     * @return true: the edge exists, false: otherwise.
+     */
+    template <bool digraph>
+    bool hasEdge(int vertex1, int vertex2);
+
+    /**
+     * Store the edge (vertex1, vertex2), which must not exist yet.
+     * This function does not update the number of edges.
+     *
+     * @tparam digraph true: digraph, false: no digraph, must equal isDigraph.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     */
+    template <bool digraph>
+    void storeEdge(int vertex1, int vertex2);
+
+    /**
+     * Return the next (outgoing) neighbor of the given vertex.
+     *
+     * @param vertex index of the given vertex.
+     * @param position pointer to the position, where the search continues. It must be zero
+     *       for the first call and is updated by this function.
+     *
+     * @return the index of the neighbor or -1, if all neighbors have been visited.
+     */
+    int nextNeighbor(int vertex, int *position);
+
+    /**
+     * Start a new local search, afterwards no vertex is visited.
+     * This costs O(1) instead of O(N) for resetting an array of marks.
+     */
+    void startVisit();
+
+    /**
+     * Count the given edge in the degrees of both vertices, loops are not counted.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     */
+    void addDegree(int vertex1, int vertex2);
+
+    /**
+     * Append the given removed edge to the journal and update the number of edges
+     * and the degrees.
+     * If the components are tracked, the neighbor is saved as well or the edge is
+     * removed from the dynamic connectivity structure.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     * @param neighbor the index of the vertex of the edge, whose edges are not removed.
+     */
+    void recordRemovedEdge(int vertex1, int vertex2, int neighbor);
+
+    /**
+     * Return the group of the given search. Searches, which have met each other,
+     * belong to the same group, because they explore the same part.
+     *
+     * @param search, the index of the given search.
+     *
+     * @return the index of the group.
+     */
+    int findGroup(int search);
+
+    /**
+     * Update the tracked components after all edges of the given vertex have been removed.
+     * Only the former component of the vertex is explored again: one depth-first search
+     * starts at each former neighbor and all searches proceed in turns. The exploration
+     * stops as soon as all parts except of one are complete.
+     *
+     * @param vertex, the index of the given vertex.
+     */
+    void splitComponent(int vertex);
 
     /**
      * Find an unmarked vertex, which is the tail of an edge from the given vertex.
      * This function is an auxiliary function for calculating the size of the largest components.
+     * The search continues at position[vertex], because marked vertices never become unmarked
+     * during one search. Hence each vertex costs O(degree) (list) or O(N) (matrix) in total.
      *
      * @param vertex index of the given vertex.
      * @param marked an array of length numberOfVertices which contains informations
      *       about the visited vertices.
+     * @param position an array of length numberOfVertices which contains for each vertex
+     *       where to continue the search, must be initialized with zero.
      *
      * @return the index of an unmarked vertex of -1, if all vertices are marked.
      */
-    int unmarkedVertex(int vertex, bool marked[]);
+    int unmarkedVertex(int vertex, bool marked[], int position[]);
 
     /**
-     * Calculate the size of the largest component using a depth-first search algorithm.
+     * Find an unmarked vertex, which is the tail of an edge from the given vertex,
+     * in the adjacency matrix. The undirected graph stores the edges (vertex, j) with j < vertex
+     * in the row of the vertex and the edges with j > vertex in its column, hence both parts
+     * are scanned by separate loops instead of testing the convention for each j.
+     *
+     * @tparam digraph true: digraph, false: no digraph, must equal isDigraph.
+     *
+     * @param vertex index of the given vertex.
+     * @param marked an array of length numberOfVertices which contains informations
+     *       about the visited vertices.
+     * @param position an array of length numberOfVertices which contains for each vertex
+     *       where to continue the search, must be initialized with zero.
+     *
+     * @return the index of an unmarked vertex of -1, if all vertices are marked.
+     */
+    template <bool digraph>
+    int unmarkedMatrixVertex(int vertex, bool marked[], int position[]);
+
+    /**
+     * Calculate the size of the largest component, the number of components and the labels
+     * and the sizes of the components using a depth-first search algorithm, also if the
+     * components are tracked, because the tracking structures do not provide the labels.
+     * The weakly or strongly connected components of a digraph are calculated
+     * by weakComponents or strongComponents.
      */
     void sizeOfLargestComponent();
 
     /**
-     * This function inserts for the given index all feasible edges with
-     * a certain probability.
-     * Note: This function requires that all inheriting classes overwrite
-     * function mustInsertEdge which decides for a vertex, if it is inserted.
-     *
-     * @param vertex the index of the given vertex.
+     * Calculate the weakly connected components of the digraph by a union-find
+     * over all edges, which costs O(N + M) (list) or O(N^2) (matrix).
      */
-    void insertEdgesRandom(int vertex);
+    void weakComponents();
 
     /**
-     * Delete all edges of the given vertex.
+     * Return the root of the given vertex in the union-find of weakComponents.
      *
-     * @param vertex, the index of the given vertex.
+     * @param vertex index of the given vertex.
      *
-     * @return stack with all indices of removed edges.
+     * @return the index of the root.
      */
-    std::stack<edge> removeAllEdgesOfVertex(int vertex);
+    int findUnionRoot(int vertex);
 
     /**
-     * Add the given edge to the graph, if possible.
+     * Calculate the strongly connected components of the digraph by an iterative
+     * version of the algorithm of Tarjan, which costs O(N + M) (list) or O(N^2) (matrix).
+     */
+    void strongComponents();
+
+    /**
+     * Calculate the size of the 2-core by removing the vertices with less than two
+     * remaining neighbors, searchPosition holds the remaining degrees and searchStack
+     * the removed vertices, whose neighbors have not been updated yet.
+     */
+    void twoCore();
+
+    /**
+     * Calculate the size of the largest component of the proposed candidate graph using
+     * a depth-first search algorithm, which replaces the stored edges of the choosen vertex
+     * by the proposed ones. The components of an undirected graph do not depend on the order
+     * of the start vertices, hence the component of the choosen vertex is searched first.
+     * Afterwards the choosen vertex is marked, such that its stored edges are never used.
+     * For digraphs the choosen vertex is hidden by a mark until it is reached.
+     * The search stops as soon as a component is bigger than the given bound or no unmarked
+     * component can be bigger than the largest one, in the latter case the number of
+     * components is unknown (-1).
      *
-     * @param vertex1, index of the first vertex.
-     * @param vertex2, index of the second vertex.
+     * @param bound the maximum size, which is of interest.
+     *
+     * @return true: the size has been calculated, false: the bound has been exceeded.
      */
-    void addEdge(int vertex1, int vertex2);
+    bool sizeOfLargestCandidateComponent(int bound);
+
+    /**
+     * Revert the applied candidate graph. Remove all edges of the choosen
+     * vertex and add all old ones from the undo journal.
+     */
+    void revertCandidateGraph();
 
     /**
-     * Add the given edge to the digraph, if possible.
+     * Delete all edges of the given vertex. The removed edges are appended to the journal.
      *
-     * @param vertex1 index of the first vertex.
-     * @param vertex2 index of the second vertex.
+     * @param vertex, the index of the given vertex.
      */
-    void addEdgeDigraph(int vertex1, int vertex2);
+    void removeAllEdgesOfVertex(int vertex);
 
     /**
-     * Add the given edge to the undirected graph, if possible.
+     * Add the given edge to the graph, if possible.
      *
-     * @param vertex1 index of the first vertex.
-     * @param vertex2 index of the second vertex.
+     * @param vertex1, index of the first vertex.
+     * @param vertex2, index of the second vertex.
      */
-    void addEdgeNonDigraph(int vertex1, int vertex2);
+    void addEdge(int vertex1, int vertex2);
+
 };
 
 #endif // ABSTRACTGRAPH_H_INCLUDED
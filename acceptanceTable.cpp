@@ -0,0 +1,86 @@
+/*
+ * acceptanceTable.cpp
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "acceptanceTable.h"
+
+#include <algorithm>
+#include <math.h>
+
+/**
+ * Constructor for calculating the table.
+ *
+ * @param temperature, the artificial temperature.
+ * @param numberOfVertices, the maximum absolute difference.
+ */
+AcceptanceTable::AcceptanceTable(double temperature, int numberOfVertices) {
+    AcceptanceTable::temperature = temperature;
+    AcceptanceTable::numberOfVertices = numberOfVertices;
+    threshold = new long[2 * numberOfVertices + 1];
+    for (int difference = -numberOfVertices; difference <= numberOfVertices; difference++) {
+        double probability = std::min(1.0, exp(-((double) difference) / temperature));
+        // the random integer r is accepted, if r / RANDOMINTEGERRANGE <= probability
+        threshold[difference + numberOfVertices] = (long) floor(probability * ((double) RANDOMINTEGERRANGE));
+    }
+}
+
+/**
+ * Destructor.
+ */
+AcceptanceTable::~AcceptanceTable() {
+    delete [] threshold;
+}
+
+/**
+ * Decide whether to accept a step with the given difference.
+ *
+ * @param difference, the value of the candidate graph minus the value of the current graph.
+ * @param randomInteger, the random integer drawn for this decision.
+ *
+ * @return true: accept the step, false: reject the step.
+ */
+bool AcceptanceTable::accept(int difference, long randomInteger) {
+    return(randomInteger <= threshold[difference + numberOfVertices]);
+}
+
+/**
+ * Return the maximum difference, which is accepted with the given random integer.
+ *
+ * @param randomInteger, the random integer drawn for this decision.
+ *
+ * @return the maximum accepted difference.
+ */
+int AcceptanceTable::maximumAcceptedDifference(long randomInteger) {
+    if (temperature < 0.0) {
+        // each bigger value is accepted
+        return(numberOfVertices);
+    }
+    // the thresholds do not increase with the difference and a difference of zero is always accepted
+    int lower = 0;
+    int upper = numberOfVertices;
+    while (lower < upper) {
+        int middle = (lower + upper + 1) / 2;
+        if (randomInteger <= threshold[middle + numberOfVertices]) {
+            lower = middle;
+        } else {
+            upper = middle - 1;
+        }
+    }
+    return(lower);
+}
@@ -0,0 +1,74 @@
+/*
+ * acceptanceTable.h
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACCEPTANCETABLE_H_INCLUDED
+#define ACCEPTANCETABLE_H_INCLUDED
+
+#include "randomGenerator.h"
+
+/**
+ * Define a table of the Metropolis acceptance probabilities min(1, exp(-dS / T))
+ * for one temperature, where dS in [-N, N] is the difference of the integer values
+ * of the candidate graph and the current graph. The probabilities are stored as
+ * integer thresholds for the random integers of the RandomGenerator, hence
+ * accepting a step requires neither exp() nor a conversion of the random number.
+ */
+class AcceptanceTable {
+public:
+    /**
+     * Constructor for calculating the table.
+     *
+     * @param temperature, the artificial temperature.
+     * @param numberOfVertices, the maximum absolute difference.
+     */
+    AcceptanceTable(double temperature, int numberOfVertices);
+
+    /**
+     * Destructor.
+     */
+    ~AcceptanceTable();
+
+    /**
+     * Decide whether to accept a step with the given difference.
+     *
+     * @param difference, the value of the candidate graph minus the value of the current graph.
+     * @param randomInteger, the random integer drawn for this decision.
+     *
+     * @return true: accept the step, false: reject the step.
+     */
+    bool accept(int difference, long randomInteger);
+
+    /**
+     * Return the maximum difference, which is accepted with the given random integer.
+     *
+     * @param randomInteger, the random integer drawn for this decision.
+     *
+     * @return the maximum accepted difference.
+     */
+    int maximumAcceptedDifference(long randomInteger);
+
+private:
+    double temperature;
+    int numberOfVertices;
+    // threshold[dS + numberOfVertices] is the maximum accepted random integer
+    long *threshold;
+};
+
+#endif // ACCEPTANCETABLE_H_INCLUDED
@@ -0,0 +1,287 @@
+/*
+ * adjacencyList.cpp
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "adjacencyList.h"
+
+// Per convention an empty slot of the position table has the key -1.
+#define EMPTYKEY -1
+
+/******************* PositionTable *******************/
+
+/**
+ * Constructor for setting up an empty table.
+ *
+ * @param expectedSize, the number of entries the table should hold without growing.
+ */
+PositionTable::PositionTable(int expectedSize) {
+    // the load factor of the table is kept below 1/2
+    capacity = 16;
+    shift = 60;
+    while (capacity < 2 * expectedSize) {
+        capacity = capacity * 2;
+        shift--;
+    }
+    keys = new long long[capacity];
+    positions = new int[capacity];
+    PositionTable::clear();
+}
+
+/**
+ * Destructor.
+ */
+PositionTable::~PositionTable() {
+    delete [] keys;
+    delete [] positions;
+}
+
+/**
+ * Calculate the home slot of the given key.
+ *
+ * @param key, the key of the edge.
+ *
+ * @return the index of the home slot.
+ */
+int PositionTable::homeSlot(long long key) {
+    // Fibonacci hashing
+    return((int) ((((unsigned long long) key) * 0x9E3779B97F4A7C15ULL) >> shift));
+}
+
+/**
+ * Search the position for the given key.
+ *
+ * @param key, the key of the edge.
+ *
+ * @return the position or -1, if the key is not in the table.
+ */
+int PositionTable::find(long long key) {
+    int slot = PositionTable::homeSlot(key);
+    while (keys[slot] != EMPTYKEY) {
+        if (keys[slot] == key) {
+            return(positions[slot]);
+        }
+        slot = (slot + 1) & (capacity - 1);
+    }
+    return(-1);
+}
+
+/**
+ * Insert the given key or overwrite its position, if it is already in the table.
+ *
+ * @param key, the key of the edge.
+ * @param position, the position of the edge.
+ */
+void PositionTable::insert(long long key, int position) {
+    int slot = PositionTable::homeSlot(key);
+    while (keys[slot] != EMPTYKEY) {
+        if (keys[slot] == key) {
+            positions[slot] = position;
+            return;
+        }
+        slot = (slot + 1) & (capacity - 1);
+    }
+    keys[slot] = key;
+    positions[slot] = position;
+    numberOfEntries++;
+    if (2 * numberOfEntries > capacity) {
+        PositionTable::grow();
+    }
+}
+
+/**
+ * Remove the given key from the table, if it is in the table.
+ *
+ * @param key, the key of the edge.
+ */
+void PositionTable::erase(long long key) {
+    int slot = PositionTable::homeSlot(key);
+    while (keys[slot] != key) {
+        if (keys[slot] == EMPTYKEY) {
+            return;
+        }
+        slot = (slot + 1) & (capacity - 1);
+    }
+    keys[slot] = EMPTYKEY;
+    numberOfEntries--;
+    // shift the following entries of the cluster backwards, such that no tombstones are required
+    int next = (slot + 1) & (capacity - 1);
+    while (keys[next] != EMPTYKEY) {
+        int home = PositionTable::homeSlot(keys[next]);
+        // move the entry, if its home slot is not cyclically in (slot, next]
+        bool stays = (slot <= next) ? ((slot < home) && (home <= next))
+                                    : ((slot < home) || (home <= next));
+        if (!stays) {
+            keys[slot] = keys[next];
+            positions[slot] = positions[next];
+            keys[next] = EMPTYKEY;
+            slot = next;
+        }
+        next = (next + 1) & (capacity - 1);
+    }
+}
+
+/**
+ * Remove all keys from the table.
+ */
+void PositionTable::clear() {
+    for (int i = 0; i < capacity; i++) {
+        keys[i] = EMPTYKEY;
+    }
+    numberOfEntries = 0;
+}
+
+/**
+ * Double the capacity of the table and rehash all entries.
+ */
+void PositionTable::grow() {
+    long long *oldKeys = keys;
+    int *oldPositions = positions;
+    int oldCapacity = capacity;
+    capacity = capacity * 2;
+    shift--;
+    keys = new long long[capacity];
+    positions = new int[capacity];
+    PositionTable::clear();
+    for (int i = 0; i < oldCapacity; i++) {
+        if (oldKeys[i] != EMPTYKEY) {
+            PositionTable::insert(oldKeys[i], oldPositions[i]);
+        }
+    }
+    delete [] oldKeys;
+    delete [] oldPositions;
+}
+
+/******************* AdjacencyList *******************/
+
+/**
+ * Constructor for setting up an empty adjacency list.
+ *
+ * @param n number of vertices.
+ * @param digraph true: digraph, false: no digraph.
+ */
+AdjacencyList::AdjacencyList(int n, bool digraph) {
+    numberOfVertices = n;
+    isDigraph = digraph;
+    outNeighbors = new std::vector<int>[n];
+    outPositions = new PositionTable(2 * n);
+    if (isDigraph) {
+        inNeighbors = new std::vector<int>[n];
+        inPositions = new PositionTable(2 * n);
+    } else {
+        inNeighbors = NULL;
+        inPositions = NULL;
+    }
+}
+
+/**
+ * Destructor.
+ */
+AdjacencyList::~AdjacencyList() {
+    delete [] outNeighbors;
+    delete outPositions;
+    if (isDigraph) {
+        delete [] inNeighbors;
+        delete inPositions;
+    }
+}
+
+/**
+ * Test whether the edge (vertex1, vertex2) exists.
+ *
+ * @param vertex1 index of the head of the edge.
+ * @param vertex2 index of the tail of the edge.
+ *
+ * @return true: the edge exists, false: otherwise.
+ */
+bool AdjacencyList::hasEdge(int vertex1, int vertex2) {
+    return(outPositions->find(AdjacencyList::edgeKey(vertex1, vertex2)) != -1);
+}
+
+/**
+ * Insert the edge (vertex1, vertex2). The edge must not exist.
+ *
+ * @param vertex1 index of the head of the edge.
+ * @param vertex2 index of the tail of the edge.
+ */
+void AdjacencyList::addEdge(int vertex1, int vertex2) {
+    outPositions->insert(AdjacencyList::edgeKey(vertex1, vertex2), (int) outNeighbors[vertex1].size());
+    outNeighbors[vertex1].push_back(vertex2);
+    if (isDigraph) {
+        // the ingoing array of vertex2 is indexed by the same key
+        inPositions->insert(AdjacencyList::edgeKey(vertex1, vertex2), (int) inNeighbors[vertex2].size());
+        inNeighbors[vertex2].push_back(vertex1);
+    } else if (vertex1 != vertex2) {
+        // an undirected edge is stored in the arrays of both vertices, loops just once
+        outPositions->insert(AdjacencyList::edgeKey(vertex2, vertex1), (int) outNeighbors[vertex2].size());
+        outNeighbors[vertex2].push_back(vertex1);
+    }
+}
+
+/**
+ * Remove the edge (vertex1, vertex2). The edge must exist.
+ *
+ * @param vertex1 index of the head of the edge.
+ * @param vertex2 index of the tail of the edge.
+ */
+void AdjacencyList::removeEdge(int vertex1, int vertex2) {
+    AdjacencyList::removeEntry(outNeighbors, outPositions, vertex1, vertex2, false);
+    if (isDigraph) {
+        AdjacencyList::removeEntry(inNeighbors, inPositions, vertex2, vertex1, true);
+    } else if (vertex1 != vertex2) {
+        AdjacencyList::removeEntry(outNeighbors, outPositions, vertex2, vertex1, false);
+    }
+}
+
+/**
+ * Remove all edges.
+ */
+void AdjacencyList::clear() {
+    for (int i = 0; i < numberOfVertices; i++) {
+        outNeighbors[i].clear();
+        if (isDigraph) {
+            inNeighbors[i].clear();
+        }
+    }
+    outPositions->clear();
+    if (isDigraph) {
+        inPositions->clear();
+    }
+}
+
+/**
+ * Remove the given entry from the neighbor array of owner by swapping it with the last entry.
+ *
+ * @param neighbors the neighbor arrays.
+ * @param positions the positions of the entries in the neighbor arrays.
+ * @param owner the vertex, whose array is modified.
+ * @param entry the vertex, which is removed from the array of owner.
+ * @param incoming true: the arrays contain ingoing neighbors, false: outgoing neighbors.
+ */
+void AdjacencyList::removeEntry(std::vector<int> *neighbors, PositionTable *positions,
+                                int owner, int entry, bool incoming) {
+    // ingoing arrays are indexed by the key of the edge (entry, owner)
+    long long key = incoming ? AdjacencyList::edgeKey(entry, owner) : AdjacencyList::edgeKey(owner, entry);
+    int position = positions->find(key);
+    int last = neighbors[owner].back();
+    // move the last entry into the gap
+    neighbors[owner][position] = last;
+    positions->insert(incoming ? AdjacencyList::edgeKey(last, owner) : AdjacencyList::edgeKey(owner, last), position);
+    neighbors[owner].pop_back();
+    positions->erase(key);
+}
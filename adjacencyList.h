@@ -0,0 +1,228 @@
+/*
+ * adjacencyList.h
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ADJACENCYLIST_H_INCLUDED
+#define ADJACENCYLIST_H_INCLUDED
+
+#include <stdlib.h>
+#include <vector>
+
+/**
+ * Define an open addressing hash table, which maps the key of an edge
+ * to the position of the edge in a neighbor array.
+ */
+class PositionTable {
+public:
+    /**
+     * Constructor for setting up an empty table.
+     *
+     * @param expectedSize, the number of entries the table should hold without growing.
+     */
+    PositionTable(int expectedSize);
+
+    /**
+     * Destructor.
+     */
+    ~PositionTable();
+
+    /**
+     * Search the position for the given key.
+     *
+     * @param key, the key of the edge.
+     *
+     * @return the position or -1, if the key is not in the table.
+     */
+    int find(long long key);
+
+    /**
+     * Insert the given key or overwrite its position, if it is already in the table.
+     *
+     * @param key, the key of the edge.
+     * @param position, the position of the edge.
+     */
+    void insert(long long key, int position);
+
+    /**
+     * Remove the given key from the table, if it is in the table.
+     *
+     * @param key, the key of the edge.
+     */
+    void erase(long long key);
+
+    /**
+     * Remove all keys from the table.
+     */
+    void clear();
+
+private:
+    long long *keys;
+    int *positions;
+    int capacity;
+    int numberOfEntries;
+    int shift;
+
+    /**
+     * Calculate the home slot of the given key.
+     *
+     * @param key, the key of the edge.
+     *
+     * @return the index of the home slot.
+     */
+    int homeSlot(long long key);
+
+    /**
+     * Double the capacity of the table and rehash all entries.
+     */
+    void grow();
+};
+
+/**
+ * Define a sparse graph storage, where each vertex has an array of its neighbors.
+ * The position of each edge in the neighbor arrays is stored in a hash table,
+ * such that testing, inserting and removing an edge costs O(1).
+ * For digraphs the outgoing and the ingoing neighbors are stored separately.
+ * For undirected graphs each edge is stored in the arrays of both vertices.
+ */
+class AdjacencyList {
+public:
+    /**
+     * Constructor for setting up an empty adjacency list.
+     *
+     * @param n number of vertices.
+     * @param digraph true: digraph, false: no digraph.
+     */
+    AdjacencyList(int n, bool digraph);
+
+    /**
+     * Destructor.
+     */
+    ~AdjacencyList();
+
+    /**
+     * Test whether the edge (vertex1, vertex2) exists.
+     *
+     * @param vertex1 index of the head of the edge.
+     * @param vertex2 index of the tail of the edge.
+     *
+     * @return true: the edge exists, false: otherwise.
+     */
+    bool hasEdge(int vertex1, int vertex2);
+
+    /**
+     * Insert the edge (vertex1, vertex2). The edge must not exist.
+     *
+     * @param vertex1 index of the head of the edge.
+     * @param vertex2 index of the tail of the edge.
+     */
+    void addEdge(int vertex1, int vertex2);
+
+    /**
+     * Remove the edge (vertex1, vertex2). The edge must exist.
+     *
+     * @param vertex1 index of the head of the edge.
+     * @param vertex2 index of the tail of the edge.
+     */
+    void removeEdge(int vertex1, int vertex2);
+
+    /**
+     * Remove all edges.
+     */
+    void clear();
+
+    /**
+     * Return the number of (outgoing) neighbors of the given vertex.
+     *
+     * @param vertex the index of the given vertex.
+     *
+     * @return the number of neighbors.
+     */
+    inline int getDegree(int vertex) {
+        return((int) outNeighbors[vertex].size());
+    }
+
+    /**
+     * Return the given (outgoing) neighbor of the given vertex.
+     *
+     * @param vertex the index of the given vertex.
+     * @param index the position of the neighbor in [0, getDegree(vertex)).
+     *
+     * @return the index of the neighbor.
+     */
+    inline int getNeighbor(int vertex, int index) {
+        return(outNeighbors[vertex][index]);
+    }
+
+    /**
+     * Return the number of ingoing neighbors of the given vertex (digraph only).
+     *
+     * @param vertex the index of the given vertex.
+     *
+     * @return the number of ingoing neighbors.
+     */
+    inline int getInDegree(int vertex) {
+        return((int) inNeighbors[vertex].size());
+    }
+
+    /**
+     * Return the given ingoing neighbor of the given vertex (digraph only).
+     *
+     * @param vertex the index of the given vertex.
+     * @param index the position of the neighbor in [0, getInDegree(vertex)).
+     *
+     * @return the index of the ingoing neighbor.
+     */
+    inline int getInNeighbor(int vertex, int index) {
+        return(inNeighbors[vertex][index]);
+    }
+
+private:
+    int numberOfVertices;
+    bool isDigraph;
+    std::vector<int> *outNeighbors;
+    std::vector<int> *inNeighbors;
+    PositionTable *outPositions;
+    PositionTable *inPositions;
+
+    /**
+     * Calculate the key of the edge (vertex1, vertex2).
+     *
+     * @param vertex1 index of the head of the edge.
+     * @param vertex2 index of the tail of the edge.
+     *
+     * @return the key of the edge.
+     */
+    inline long long edgeKey(int vertex1, int vertex2) {
+        return(((long long) vertex1) * ((long long) numberOfVertices) + ((long long) vertex2));
+    }
+
+    /**
+     * Remove the given entry from the neighbor array of owner by swapping it with the last entry.
+     *
+     * @param neighbors the neighbor arrays.
+     * @param positions the positions of the entries in the neighbor arrays.
+     * @param owner the vertex, whose array is modified.
+     * @param entry the vertex, which is removed from the array of owner.
+     * @param incoming true: the arrays contain ingoing neighbors, false: outgoing neighbors.
+     */
+    void removeEntry(std::vector<int> *neighbors, PositionTable *positions,
+                     int owner, int entry, bool incoming);
+};
+
+#endif // ADJACENCYLIST_H_INCLUDED
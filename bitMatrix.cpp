@@ -0,0 +1,200 @@
+/*
+ * bitMatrix.cpp
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bitMatrix.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Allocate a zeroed buffer of the given number of words aligned to a cache line.
+ *
+ * @param words the number of words.
+ *
+ * @return pointer to the buffer.
+ */
+static uint64_t *allocateAligned(size_t words) {
+    void *buffer;
+    if (posix_memalign(&buffer, 64, words * sizeof(uint64_t)) != 0) {
+        perror("Could not allocate the bit matrix");
+        exit(EXIT_FAILURE);
+    }
+    memset(buffer, 0, words * sizeof(uint64_t));
+    return((uint64_t*) buffer);
+}
+
+/**
+ * Constructor for setting up an empty bit matrix.
+ *
+ * @param n number of vertices.
+ * @param digraph true: digraph, false: no digraph.
+ */
+BitMatrix::BitMatrix(int n, bool digraph) {
+    numberOfVertices = n;
+    isDigraph = digraph;
+    // round up to whole cache lines of eight words
+    wordsPerRow = (((n + 63) / 64 + 7) / 8) * 8;
+    rows = allocateAligned(((size_t) n) * ((size_t) wordsPerRow));
+    if (isDigraph) {
+        transposedRows = allocateAligned(((size_t) n) * ((size_t) wordsPerRow));
+    } else {
+        transposedRows = NULL;
+    }
+}
+
+/**
+ * Destructor.
+ */
+BitMatrix::~BitMatrix() {
+    free(rows);
+    if (isDigraph) {
+        free(transposedRows);
+    }
+}
+
+/**
+ * Insert the edge (vertex1, vertex2).
+ *
+ * @param vertex1 index of the head of the edge.
+ * @param vertex2 index of the tail of the edge.
+ */
+void BitMatrix::addEdge(int vertex1, int vertex2) {
+    BitMatrix::getRow(vertex1)[vertex2 >> 6] |= (1ULL << (vertex2 & 63));
+    if (isDigraph) {
+        BitMatrix::getTransposedRow(vertex2)[vertex1 >> 6] |= (1ULL << (vertex1 & 63));
+    } else {
+        // keep the matrix symmetric
+        BitMatrix::getRow(vertex2)[vertex1 >> 6] |= (1ULL << (vertex1 & 63));
+    }
+}
+
+/**
+ * Remove all edges of the given vertex.
+ *
+ * @param vertex the index of the given vertex.
+ */
+void BitMatrix::clearVertex(int vertex) {
+    uint64_t *row = BitMatrix::getRow(vertex);
+    uint64_t vertexMask = ~(1ULL << (vertex & 63));
+    int vertexWord = vertex >> 6;
+    int i;
+    // clear the mirrored bits of all neighbors, then the rows word-wide
+    if (isDigraph) {
+        uint64_t *transposedRow = BitMatrix::getTransposedRow(vertex);
+        for (i = BitMatrix::nextBit(row, 0); i != -1; i = BitMatrix::nextBit(row, i + 1)) {
+            BitMatrix::getTransposedRow(i)[vertexWord] &= vertexMask;
+        }
+        for (i = BitMatrix::nextBit(transposedRow, 0); i != -1; i = BitMatrix::nextBit(transposedRow, i + 1)) {
+            BitMatrix::getRow(i)[vertexWord] &= vertexMask;
+        }
+        memset(transposedRow, 0, wordsPerRow * sizeof(uint64_t));
+    } else {
+        for (i = BitMatrix::nextBit(row, 0); i != -1; i = BitMatrix::nextBit(row, i + 1)) {
+            BitMatrix::getRow(i)[vertexWord] &= vertexMask;
+        }
+    }
+    memset(row, 0, wordsPerRow * sizeof(uint64_t));
+}
+
+/**
+ * Remove all edges.
+ */
+void BitMatrix::clear() {
+    memset(rows, 0, ((size_t) numberOfVertices) * ((size_t) wordsPerRow) * sizeof(uint64_t));
+    if (isDigraph) {
+        memset(transposedRows, 0, ((size_t) numberOfVertices) * ((size_t) wordsPerRow) * sizeof(uint64_t));
+    }
+}
+
+/**
+ * Search the next (outgoing) neighbor of the given vertex.
+ *
+ * @param vertex the index of the given vertex.
+ * @param start the smallest index to consider.
+ *
+ * @return the index of the neighbor or -1, if there is no such neighbor.
+ */
+int BitMatrix::nextNeighbor(int vertex, int start) {
+    return(BitMatrix::nextBit(BitMatrix::getRow(vertex), start));
+}
+
+/**
+ * Search the next ingoing neighbor of the given vertex (digraph only).
+ *
+ * @param vertex the index of the given vertex.
+ * @param start the smallest index to consider.
+ *
+ * @return the index of the ingoing neighbor or -1, if there is no such neighbor.
+ */
+int BitMatrix::nextInNeighbor(int vertex, int start) {
+    return(BitMatrix::nextBit(BitMatrix::getTransposedRow(vertex), start));
+}
+
+/**
+ * Search the next (outgoing) neighbor of the given vertex, which is not marked.
+ * The search is done word by word on row & ~marked.
+ *
+ * @param vertex the index of the given vertex.
+ * @param marked the marked vertices packed into getWordsPerRow() words.
+ * @param start the smallest index to consider.
+ *
+ * @return the index of the unmarked neighbor or -1, if there is no such neighbor.
+ */
+int BitMatrix::nextUnmarkedNeighbor(int vertex, const uint64_t *marked, int start) {
+    const uint64_t *row = BitMatrix::getRow(vertex);
+    int word = start >> 6;
+    if (start >= numberOfVertices) {
+        return(-1);
+    }
+    // mask out the bits in front of start in the first word
+    uint64_t candidates = row[word] & ~marked[word] & (~0ULL << (start & 63));
+    while (candidates == 0) {
+        word++;
+        if (word >= wordsPerRow) {
+            return(-1);
+        }
+        candidates = row[word] & ~marked[word];
+    }
+    return((word << 6) + __builtin_ctzll(candidates));
+}
+
+/**
+ * Search the next set bit in the given row.
+ *
+ * @param row pointer to the first word of the row.
+ * @param start the smallest index to consider.
+ *
+ * @return the index of the bit or -1, if there is no such bit.
+ */
+int BitMatrix::nextBit(const uint64_t *row, int start) {
+    int word = start >> 6;
+    if (start >= numberOfVertices) {
+        return(-1);
+    }
+    uint64_t candidates = row[word] & (~0ULL << (start & 63));
+    while (candidates == 0) {
+        word++;
+        if (word >= wordsPerRow) {
+            return(-1);
+        }
+        candidates = row[word];
+    }
+    return((word << 6) + __builtin_ctzll(candidates));
+}
@@ -0,0 +1,162 @@
+/*
+ * bitMatrix.h
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BITMATRIX_H_INCLUDED
+#define BITMATRIX_H_INCLUDED
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * Define a bit-packed adjacency matrix. All rows are stored in one contiguous buffer
+ * of 64 bit words, each row starts at a cache line (64 byte) boundary.
+ * For undirected graphs the matrix is symmetric, such that each row contains all
+ * neighbors of a vertex. For digraphs the transposed matrix is stored as well,
+ * such that the ingoing neighbors of a vertex can be scanned word by word.
+ */
+class BitMatrix {
+public:
+    /**
+     * Constructor for setting up an empty bit matrix.
+     *
+     * @param n number of vertices.
+     * @param digraph true: digraph, false: no digraph.
+     */
+    BitMatrix(int n, bool digraph);
+
+    /**
+     * Destructor.
+     */
+    ~BitMatrix();
+
+    /**
+     * Test whether the edge (vertex1, vertex2) exists.
+     *
+     * @param vertex1 index of the head of the edge.
+     * @param vertex2 index of the tail of the edge.
+     *
+     * @return true: the edge exists, false: otherwise.
+     */
+    inline bool hasEdge(int vertex1, int vertex2) {
+        return((BitMatrix::getRow(vertex1)[vertex2 >> 6] >> (vertex2 & 63)) & 1);
+    }
+
+    /**
+     * Insert the edge (vertex1, vertex2).
+     *
+     * @param vertex1 index of the head of the edge.
+     * @param vertex2 index of the tail of the edge.
+     */
+    void addEdge(int vertex1, int vertex2);
+
+    /**
+     * Remove all edges of the given vertex.
+     *
+     * @param vertex the index of the given vertex.
+     */
+    void clearVertex(int vertex);
+
+    /**
+     * Remove all edges.
+     */
+    void clear();
+
+    /**
+     * Search the next (outgoing) neighbor of the given vertex.
+     *
+     * @param vertex the index of the given vertex.
+     * @param start the smallest index to consider.
+     *
+     * @return the index of the neighbor or -1, if there is no such neighbor.
+     */
+    int nextNeighbor(int vertex, int start);
+
+    /**
+     * Search the next ingoing neighbor of the given vertex (digraph only).
+     *
+     * @param vertex the index of the given vertex.
+     * @param start the smallest index to consider.
+     *
+     * @return the index of the ingoing neighbor or -1, if there is no such neighbor.
+     */
+    int nextInNeighbor(int vertex, int start);
+
+    /**
+     * Search the next (outgoing) neighbor of the given vertex, which is not marked.
+     * The search is done word by word on row & ~marked.
+     *
+     * @param vertex the index of the given vertex.
+     * @param marked the marked vertices packed into getWordsPerRow() words.
+     * @param start the smallest index to consider.
+     *
+     * @return the index of the unmarked neighbor or -1, if there is no such neighbor.
+     */
+    int nextUnmarkedNeighbor(int vertex, const uint64_t *marked, int start);
+
+    /**
+     * Return the number of words of each row.
+     *
+     * @return the number of words per row.
+     */
+    inline int getWordsPerRow() {
+        return(wordsPerRow);
+    }
+
+    /**
+     * Return the row of the given vertex.
+     *
+     * @param vertex the index of the given vertex.
+     *
+     * @return pointer to the first word of the row.
+     */
+    inline uint64_t *getRow(int vertex) {
+        return(rows + ((size_t) vertex) * ((size_t) wordsPerRow));
+    }
+
+private:
+    int numberOfVertices;
+    bool isDigraph;
+    int wordsPerRow;
+    uint64_t *rows;
+    uint64_t *transposedRows;
+
+    /**
+     * Return the row of the transposed matrix of the given vertex.
+     *
+     * @param vertex the index of the given vertex.
+     *
+     * @return pointer to the first word of the row.
+     */
+    inline uint64_t *getTransposedRow(int vertex) {
+        return(transposedRows + ((size_t) vertex) * ((size_t) wordsPerRow));
+    }
+
+    /**
+     * Search the next set bit in the given row.
+     *
+     * @param row pointer to the first word of the row.
+     * @param start the smallest index to consider.
+     *
+     * @return the index of the bit or -1, if there is no such bit.
+     */
+    int nextBit(const uint64_t *row, int start);
+};
+
+#endif // BITMATRIX_H_INCLUDED
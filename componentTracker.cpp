@@ -0,0 +1,254 @@
+/*
+ * componentTracker.cpp
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "componentTracker.h"
+
+/**
+ * Constructor for setting up the components of an empty graph.
+ *
+ * @param n number of vertices.
+ */
+ComponentTracker::ComponentTracker(int n) {
+    numberOfVertices = n;
+    // each vertex uses one node, the other half is used for separated vertices
+    capacity = 2 * n;
+    vertexNode = new int[n];
+    parent = new int[capacity];
+    componentSize = new int[capacity];
+    sizeCounter = new int[n + 1];
+    ComponentTracker::reset();
+}
+
+/**
+ * Destructor.
+ */
+ComponentTracker::~ComponentTracker() {
+    delete [] vertexNode;
+    delete [] parent;
+    delete [] componentSize;
+    delete [] sizeCounter;
+}
+
+/**
+ * Make each vertex a component of size one.
+ */
+void ComponentTracker::reset() {
+    for (int i = 0; i < numberOfVertices; i++) {
+        vertexNode[i] = i;
+        parent[i] = i;
+        componentSize[i] = 1;
+    }
+    numberOfNodes = numberOfVertices;
+    for (int i = 0; i <= numberOfVertices; i++) {
+        sizeCounter[i] = 0;
+    }
+    sizeCounter[1] = numberOfVertices;
+    numberOfComponents = numberOfVertices;
+    largestComponentSize = (numberOfVertices > 0) ? 1 : 0;
+}
+
+/**
+ * Return the root node of the component of the given vertex.
+ *
+ * @param vertex the index of the given vertex.
+ *
+ * @return the index of the root node.
+ */
+int ComponentTracker::find(int vertex) {
+    return(ComponentTracker::findRoot(vertexNode[vertex]));
+}
+
+/**
+ * Return the root of the given node.
+ *
+ * @param node the index of the given node.
+ *
+ * @return the index of the root node.
+ */
+int ComponentTracker::findRoot(int node) {
+    // path halving
+    while (parent[node] != node) {
+        parent[node] = parent[parent[node]];
+        node = parent[node];
+    }
+    return(node);
+}
+
+/**
+ * Merge the components of both vertices, because an edge has been inserted.
+ *
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ */
+void ComponentTracker::merge(int vertex1, int vertex2) {
+    int root1 = ComponentTracker::find(vertex1);
+    int root2 = ComponentTracker::find(vertex2);
+    if (root1 == root2) {
+        return;
+    }
+    // union by size: hang the smaller component below the bigger one
+    if (componentSize[root1] < componentSize[root2]) {
+        int helper = root1;
+        root1 = root2;
+        root2 = helper;
+    }
+    ComponentTracker::addSize(componentSize[root1] + componentSize[root2]);
+    ComponentTracker::removeSize(componentSize[root1]);
+    ComponentTracker::removeSize(componentSize[root2]);
+    parent[root2] = root1;
+    componentSize[root1] = componentSize[root1] + componentSize[root2];
+    numberOfComponents--;
+}
+
+/**
+ * Return the size of the component of the given vertex.
+ *
+ * @param vertex the index of the given vertex.
+ *
+ * @return the size of the component.
+ */
+int ComponentTracker::getComponentSize(int vertex) {
+    return(componentSize[ComponentTracker::find(vertex)]);
+}
+
+/**
+ * Move the given vertex out of its component into a component of size one.
+ *
+ * @param vertex the index of the given vertex.
+ */
+void ComponentTracker::isolate(int vertex) {
+    if (ComponentTracker::getComponentSize(vertex) > 1) {
+        ComponentTracker::separate(&vertex, 1);
+    }
+}
+
+/**
+ * Move the given vertices into a new component. All of them must belong
+ * to the same component.
+ *
+ * @param vertices array of the indices of the vertices.
+ * @param count the number of vertices.
+ */
+void ComponentTracker::separate(const int *vertices, int count) {
+    if (numberOfNodes + count > capacity) {
+        ComponentTracker::compact();
+    }
+    int root = ComponentTracker::find(vertices[0]);
+    // add the new sizes first, such that the largest size is not searched downwards too far
+    ComponentTracker::addSize(count);
+    ComponentTracker::addSize(componentSize[root] - count);
+    ComponentTracker::removeSize(componentSize[root]);
+    // the old nodes stay in the old tree without weight
+    componentSize[root] = componentSize[root] - count;
+    int newRoot = numberOfNodes;
+    for (int i = 0; i < count; i++) {
+        vertexNode[vertices[i]] = numberOfNodes;
+        parent[numberOfNodes] = newRoot;
+        numberOfNodes++;
+    }
+    componentSize[newRoot] = count;
+    numberOfComponents++;
+}
+
+/**
+ * Return the number of components.
+ *
+ * @return the number of components.
+ */
+int ComponentTracker::getNumberOfComponents() {
+    return(numberOfComponents);
+}
+
+/**
+ * Return the size of the largest component.
+ *
+ * @return the size of the largest component.
+ */
+int ComponentTracker::getSizeOfLargestComponent() {
+    return(largestComponentSize);
+}
+
+/**
+ * Return how many components have the given size.
+ *
+ * @param size the size of the components, between 0 and n.
+ *
+ * @return the number of components of the given size.
+ */
+int ComponentTracker::getNumberOfComponentsOfSize(int size) {
+    return(sizeCounter[size]);
+}
+
+/**
+ * Add a component of the given size to the multiset of sizes.
+ *
+ * @param size the size of the component.
+ */
+void ComponentTracker::addSize(int size) {
+    sizeCounter[size]++;
+    if (size > largestComponentSize) {
+        largestComponentSize = size;
+    }
+}
+
+/**
+ * Remove a component of the given size from the multiset of sizes.
+ *
+ * @param size the size of the component.
+ */
+void ComponentTracker::removeSize(int size) {
+    sizeCounter[size]--;
+    // the search costs at most the decrease of the largest size
+    while ((largestComponentSize > 0) && (sizeCounter[largestComponentSize] == 0)) {
+        largestComponentSize--;
+    }
+}
+
+/**
+ * Renumber the nodes, such that each vertex uses the node with its own index
+ * and all nodes without weight are freed.
+ */
+void ComponentTracker::compact() {
+    int i, root;
+    // representative[root] is the first vertex of the component of root, -1 if not known yet
+    int *representative = new int[capacity];
+    int *rootOfVertex = new int[numberOfVertices];
+    int *sizeOfVertex = new int[numberOfVertices];
+    for (i = 0; i < capacity; i++) {
+        representative[i] = -1;
+    }
+    for (i = 0; i < numberOfVertices; i++) {
+        root = ComponentTracker::find(i);
+        if (representative[root] == -1) {
+            representative[root] = i;
+        }
+        rootOfVertex[i] = representative[root];
+        sizeOfVertex[i] = componentSize[root];
+    }
+    for (i = 0; i < numberOfVertices; i++) {
+        vertexNode[i] = i;
+        parent[i] = rootOfVertex[i];
+        componentSize[i] = sizeOfVertex[i];
+    }
+    numberOfNodes = numberOfVertices;
+    delete [] representative;
+    delete [] rootOfVertex;
+    delete [] sizeOfVertex;
+}
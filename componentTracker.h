@@ -0,0 +1,160 @@
+/*
+ * componentTracker.h
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMPONENTTRACKER_H_INCLUDED
+#define COMPONENTTRACKER_H_INCLUDED
+
+/**
+ * Define a union-find structure, which keeps the components of an undirected graph
+ * up to date while edges are inserted. Each vertex is represented by a node of the
+ * union-find forest, the root node of a component stores the size of the component.
+ * Removing edges is not supported directly: the graph has to move the vertices of
+ * a part, which has been split off, into a new component using separate. Such vertices
+ * get fresh nodes, their old nodes stay in the old tree without weight. If all nodes
+ * are used, the forest is compacted.
+ * The sizes of all components are kept in a multiset, such that the size of the
+ * largest component is available in O(1).
+ */
+class ComponentTracker {
+public:
+    /**
+     * Constructor for setting up the components of an empty graph.
+     *
+     * @param n number of vertices.
+     */
+    ComponentTracker(int n);
+
+    /**
+     * Destructor.
+     */
+    ~ComponentTracker();
+
+    /**
+     * Make each vertex a component of size one.
+     */
+    void reset();
+
+    /**
+     * Return the root node of the component of the given vertex.
+     *
+     * @param vertex the index of the given vertex.
+     *
+     * @return the index of the root node.
+     */
+    int find(int vertex);
+
+    /**
+     * Merge the components of both vertices, because an edge has been inserted.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     */
+    void merge(int vertex1, int vertex2);
+
+    /**
+     * Return the size of the component of the given vertex.
+     *
+     * @param vertex the index of the given vertex.
+     *
+     * @return the size of the component.
+     */
+    int getComponentSize(int vertex);
+
+    /**
+     * Move the given vertex out of its component into a component of size one.
+     *
+     * @param vertex the index of the given vertex.
+     */
+    void isolate(int vertex);
+
+    /**
+     * Move the given vertices into a new component. All of them must belong
+     * to the same component.
+     *
+     * @param vertices array of the indices of the vertices.
+     * @param count the number of vertices.
+     */
+    void separate(const int *vertices, int count);
+
+    /**
+     * Return the number of components.
+     *
+     * @return the number of components.
+     */
+    int getNumberOfComponents();
+
+    /**
+     * Return the size of the largest component.
+     *
+     * @return the size of the largest component.
+     */
+    int getSizeOfLargestComponent();
+
+    /**
+     * Return how many components have the given size.
+     *
+     * @param size the size of the components, between 0 and n.
+     *
+     * @return the number of components of the given size.
+     */
+    int getNumberOfComponentsOfSize(int size);
+
+private:
+    int numberOfVertices;
+    int numberOfNodes;
+    int capacity;
+    int *vertexNode;
+    int *parent;
+    int *componentSize;
+    int *sizeCounter;
+    int numberOfComponents;
+    int largestComponentSize;
+
+    /**
+     * Return the root of the given node.
+     *
+     * @param node the index of the given node.
+     *
+     * @return the index of the root node.
+     */
+    int findRoot(int node);
+
+    /**
+     * Add a component of the given size to the multiset of sizes.
+     *
+     * @param size the size of the component.
+     */
+    void addSize(int size);
+
+    /**
+     * Remove a component of the given size from the multiset of sizes.
+     *
+     * @param size the size of the component.
+     */
+    void removeSize(int size);
+
+    /**
+     * Renumber the nodes, such that each vertex uses the node with its own index
+     * and all nodes without weight are freed.
+     */
+    void compact();
+};
+
+#endif // COMPONENTTRACKER_H_INCLUDED
@@ -0,0 +1,684 @@
+/*
+ * dynamicConnectivity.cpp
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dynamicConnectivity.h"
+
+/**
+ * Define the flags of a vertex node: it has tree edges of the level of its forest,
+ * it has non tree edges of the level of its forest.
+ */
+#define TREEEDGES 1
+#define NONTREEEDGES 2
+
+/**
+ * Constructor for setting up the structure of an empty graph.
+ *
+ * @param n number of vertices.
+ */
+DynamicConnectivity::DynamicConnectivity(int n) {
+    numberOfVertices = n;
+    // the trees of level i have at most N / 2^i vertices
+    numberOfLevels = 1;
+    while ((1LL << numberOfLevels) <= (long long) n) {
+        numberOfLevels++;
+    }
+    numberOfLevels++;
+    edgeTable = new PositionTable(n);
+    vertexNodeTable = new PositionTable(n);
+    arcTable = new PositionTable(2 * n);
+    sizeCounter = new int[n + 1];
+    // the priorities of the treaps use an own generator, such that the random numbers
+    // of the simulation are not affected
+    priorityState = 2463534242U;
+    DynamicConnectivity::reset();
+}
+
+/**
+ * Destructor.
+ */
+DynamicConnectivity::~DynamicConnectivity() {
+    delete edgeTable;
+    delete vertexNodeTable;
+    delete arcTable;
+    delete [] sizeCounter;
+}
+
+/**
+ * Remove all edges.
+ */
+void DynamicConnectivity::reset() {
+    nodes.clear();
+    freeNodes.clear();
+    edges.clear();
+    freeEdges.clear();
+    edgeTable->clear();
+    vertexNodeTable->clear();
+    arcTable->clear();
+    // the nodes of level 0 always exist and have the index of their vertex
+    for (int i = 0; i < numberOfVertices; i++) {
+        DynamicConnectivity::createNode(i);
+    }
+    for (int i = 0; i <= numberOfVertices; i++) {
+        sizeCounter[i] = 0;
+    }
+    sizeCounter[1] = numberOfVertices;
+    numberOfComponents = numberOfVertices;
+    largestComponentSize = (numberOfVertices > 0) ? 1 : 0;
+}
+
+/**
+ * Insert the edge (vertex1, vertex2), which must not exist yet.
+ *
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ */
+void DynamicConnectivity::insertEdge(int vertex1, int vertex2) {
+    if (vertex1 == vertex2) {
+        return;
+    }
+    int edge;
+    if (freeEdges.empty()) {
+        edge = (int) edges.size();
+        edges.push_back(connectivityEdge());
+    } else {
+        edge = freeEdges.back();
+        freeEdges.pop_back();
+    }
+    edges[edge].vertex[0] = vertex1;
+    edges[edge].vertex[1] = vertex2;
+    edges[edge].level = 0;
+    edgeTable->insert(DynamicConnectivity::edgeKey(vertex1, vertex2), edge);
+    if (DynamicConnectivity::connectedAtLevel(vertex1, vertex2, 0)) {
+        edges[edge].isTree = false;
+        DynamicConnectivity::addToLists(edge);
+    } else {
+        // the edge merges two components
+        int size1 = DynamicConnectivity::getComponentSize(vertex1);
+        int size2 = DynamicConnectivity::getComponentSize(vertex2);
+        edges[edge].isTree = true;
+        DynamicConnectivity::addToLists(edge);
+        DynamicConnectivity::link(edge, 0);
+        DynamicConnectivity::addSize(size1 + size2);
+        DynamicConnectivity::removeSize(size1);
+        DynamicConnectivity::removeSize(size2);
+        numberOfComponents--;
+    }
+}
+
+/**
+ * Remove the edge (vertex1, vertex2), which must exist.
+ *
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ */
+void DynamicConnectivity::removeEdge(int vertex1, int vertex2) {
+    if (vertex1 == vertex2) {
+        return;
+    }
+    int edge = edgeTable->find(DynamicConnectivity::edgeKey(vertex1, vertex2));
+    edgeTable->erase(DynamicConnectivity::edgeKey(vertex1, vertex2));
+    DynamicConnectivity::removeFromLists(edge);
+    freeEdges.push_back(edge);
+    if (!edges[edge].isTree) {
+        return;
+    }
+    int level = edges[edge].level;
+    int i;
+    for (i = 0; i <= level; i++) {
+        DynamicConnectivity::cut(edge, i);
+    }
+    // search a replacement, starting at the highest level
+    for (i = level; i >= 0; i--) {
+        if (DynamicConnectivity::replace(vertex1, vertex2, i)) {
+            return;
+        }
+    }
+    // the component has been split
+    int size1 = DynamicConnectivity::getComponentSize(vertex1);
+    int size2 = DynamicConnectivity::getComponentSize(vertex2);
+    DynamicConnectivity::addSize(size1);
+    DynamicConnectivity::addSize(size2);
+    DynamicConnectivity::removeSize(size1 + size2);
+    numberOfComponents++;
+}
+
+/**
+ * Test whether both vertices belong to the same component.
+ *
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ *
+ * @return true: same component, false: otherwise.
+ */
+bool DynamicConnectivity::connected(int vertex1, int vertex2) {
+    return(DynamicConnectivity::connectedAtLevel(vertex1, vertex2, 0));
+}
+
+/**
+ * Return the size of the component of the given vertex.
+ *
+ * @param vertex the index of the given vertex.
+ *
+ * @return the size of the component.
+ */
+int DynamicConnectivity::getComponentSize(int vertex) {
+    return(nodes[DynamicConnectivity::findRoot(vertex)].vertexCount);
+}
+
+/**
+ * Return the number of components.
+ *
+ * @return the number of components.
+ */
+int DynamicConnectivity::getNumberOfComponents() {
+    return(numberOfComponents);
+}
+
+/**
+ * Return the size of the largest component.
+ *
+ * @return the size of the largest component.
+ */
+int DynamicConnectivity::getSizeOfLargestComponent() {
+    return(largestComponentSize);
+}
+
+/**
+ * Return how many components have the given size.
+ *
+ * @param size the size of the components, between 0 and n.
+ *
+ * @return the number of components of the given size.
+ */
+int DynamicConnectivity::getNumberOfComponentsOfSize(int size) {
+    return(sizeCounter[size]);
+}
+
+/**
+ * Create a new node of an Euler tour.
+ *
+ * @param vertex the index of the vertex or -1, if the node represents a tree edge.
+ *
+ * @return the index of the node.
+ */
+int DynamicConnectivity::createNode(int vertex) {
+    int node;
+    if (freeNodes.empty()) {
+        node = (int) nodes.size();
+        nodes.push_back(tourNode());
+    } else {
+        node = freeNodes.back();
+        freeNodes.pop_back();
+    }
+    // xorshift
+    priorityState ^= priorityState << 13;
+    priorityState ^= priorityState >> 17;
+    priorityState ^= priorityState << 5;
+    nodes[node].left = -1;
+    nodes[node].right = -1;
+    nodes[node].parent = -1;
+    nodes[node].priority = priorityState;
+    nodes[node].nodeCount = 1;
+    nodes[node].vertexCount = (vertex == -1) ? 0 : 1;
+    nodes[node].vertex = vertex;
+    nodes[node].treeHead = -1;
+    nodes[node].nonTreeHead = -1;
+    nodes[node].flags = 0;
+    nodes[node].subtreeFlags = 0;
+    return(node);
+}
+
+/**
+ * Return the node of the given vertex in the forest of the given level.
+ *
+ * @param vertex the index of the given vertex.
+ * @param level the level of the forest.
+ * @param create true: create the node, if it does not exist yet.
+ *
+ * @return the index of the node or -1, if it does not exist.
+ */
+int DynamicConnectivity::vertexNode(int vertex, int level, bool create) {
+    if (level == 0) {
+        return(vertex);
+    }
+    // the nodes of the higher levels are created on demand, because most vertices
+    // are isolated in the higher forests
+    long long key = ((long long) level) * numberOfVertices + vertex;
+    int node = vertexNodeTable->find(key);
+    if ((node == -1) && create) {
+        node = DynamicConnectivity::createNode(vertex);
+        vertexNodeTable->insert(key, node);
+    }
+    return(node);
+}
+
+/**
+ * Recalculate the counters and flags of the given node from its children.
+ *
+ * @param node the index of the given node.
+ */
+void DynamicConnectivity::update(int node) {
+    tourNode *current = &nodes[node];
+    current->nodeCount = 1;
+    current->vertexCount = (current->vertex == -1) ? 0 : 1;
+    current->subtreeFlags = current->flags;
+    if (current->left != -1) {
+        tourNode *child = &nodes[current->left];
+        current->nodeCount += child->nodeCount;
+        current->vertexCount += child->vertexCount;
+        current->subtreeFlags |= child->subtreeFlags;
+        child->parent = node;
+    }
+    if (current->right != -1) {
+        tourNode *child = &nodes[current->right];
+        current->nodeCount += child->nodeCount;
+        current->vertexCount += child->vertexCount;
+        current->subtreeFlags |= child->subtreeFlags;
+        child->parent = node;
+    }
+}
+
+/**
+ * Recalculate the counters and flags from the given node up to the root.
+ *
+ * @param node the index of the given node.
+ */
+void DynamicConnectivity::updatePath(int node) {
+    while (node != -1) {
+        DynamicConnectivity::update(node);
+        node = nodes[node].parent;
+    }
+}
+
+/**
+ * Concatenate both tours.
+ *
+ * @param tour1 the root of the first tour or -1.
+ * @param tour2 the root of the second tour or -1.
+ *
+ * @return the root of the concatenated tour.
+ */
+int DynamicConnectivity::concatenate(int tour1, int tour2) {
+    int root = DynamicConnectivity::merge(tour1, tour2);
+    if (root != -1) {
+        nodes[root].parent = -1;
+    }
+    return(root);
+}
+
+/**
+ * Merge both treaps, auxiliary function of concatenate.
+ *
+ * @param tour1 the root of the first treap or -1.
+ * @param tour2 the root of the second treap or -1.
+ *
+ * @return the root of the merged treap.
+ */
+int DynamicConnectivity::merge(int tour1, int tour2) {
+    if (tour1 == -1) {
+        return(tour2);
+    }
+    if (tour2 == -1) {
+        return(tour1);
+    }
+    int child;
+    if (nodes[tour1].priority > nodes[tour2].priority) {
+        child = DynamicConnectivity::merge(nodes[tour1].right, tour2);
+        nodes[tour1].right = child;
+        DynamicConnectivity::update(tour1);
+        return(tour1);
+    } else {
+        child = DynamicConnectivity::merge(tour1, nodes[tour2].left);
+        nodes[tour2].left = child;
+        DynamicConnectivity::update(tour2);
+        return(tour2);
+    }
+}
+
+/**
+ * Split the tour, such that the first part contains the given number of nodes.
+ *
+ * @param tour the root of the tour.
+ * @param count the number of nodes of the first part.
+ * @param first pointer to the root of the first part.
+ * @param second pointer to the root of the second part.
+ */
+void DynamicConnectivity::split(int tour, int count, int *first, int *second) {
+    if (tour == -1) {
+        *first = -1;
+        *second = -1;
+        return;
+    }
+    int leftCount = (nodes[tour].left == -1) ? 0 : nodes[nodes[tour].left].nodeCount;
+    int part1, part2;
+    if (count <= leftCount) {
+        DynamicConnectivity::split(nodes[tour].left, count, &part1, &part2);
+        nodes[tour].left = part2;
+        DynamicConnectivity::update(tour);
+        *first = part1;
+        *second = tour;
+    } else {
+        DynamicConnectivity::split(nodes[tour].right, count - leftCount - 1, &part1, &part2);
+        nodes[tour].right = part1;
+        DynamicConnectivity::update(tour);
+        *first = tour;
+        *second = part2;
+    }
+    // the parts are roots, until they are attached by the caller
+    if (*first != -1) {
+        nodes[*first].parent = -1;
+    }
+    if (*second != -1) {
+        nodes[*second].parent = -1;
+    }
+}
+
+/**
+ * Return the root of the tour of the given node.
+ *
+ * @param node the index of the given node.
+ *
+ * @return the root of the tour.
+ */
+int DynamicConnectivity::findRoot(int node) {
+    while (nodes[node].parent != -1) {
+        node = nodes[node].parent;
+    }
+    return(node);
+}
+
+/**
+ * Return the position of the given node in its tour.
+ *
+ * @param node the index of the given node.
+ *
+ * @return the position starting at zero.
+ */
+int DynamicConnectivity::position(int node) {
+    int result = (nodes[node].left == -1) ? 0 : nodes[nodes[node].left].nodeCount;
+    while (nodes[node].parent != -1) {
+        int parent = nodes[node].parent;
+        if (nodes[parent].right == node) {
+            result += 1 + ((nodes[parent].left == -1) ? 0 : nodes[nodes[parent].left].nodeCount);
+        }
+        node = parent;
+    }
+    return(result);
+}
+
+/**
+ * Rotate the tour, such that it starts at the given node.
+ *
+ * @param node the index of the given node.
+ *
+ * @return the root of the rotated tour.
+ */
+int DynamicConnectivity::reroot(int node) {
+    int front, back;
+    int count = DynamicConnectivity::position(node);
+    DynamicConnectivity::split(DynamicConnectivity::findRoot(node), count, &front, &back);
+    return(DynamicConnectivity::concatenate(back, front));
+}
+
+/**
+ * Return a node with the given flag in the given tour.
+ *
+ * @param tour the root of the tour.
+ * @param flag the flag to search for.
+ *
+ * @return the index of the node or -1, if there is no such node.
+ */
+int DynamicConnectivity::findFlagged(int tour, unsigned char flag) {
+    if ((nodes[tour].subtreeFlags & flag) == 0) {
+        return(-1);
+    }
+    while ((nodes[tour].flags & flag) == 0) {
+        int left = nodes[tour].left;
+        if ((left != -1) && ((nodes[left].subtreeFlags & flag) != 0)) {
+            tour = left;
+        } else {
+            tour = nodes[tour].right;
+        }
+    }
+    return(tour);
+}
+
+/**
+ * Test whether both vertices are connected in the forest of the given level.
+ *
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ * @param level the level of the forest.
+ *
+ * @return true: connected, false: otherwise.
+ */
+bool DynamicConnectivity::connectedAtLevel(int vertex1, int vertex2, int level) {
+    if (vertex1 == vertex2) {
+        return(true);
+    }
+    int node1 = DynamicConnectivity::vertexNode(vertex1, level, false);
+    int node2 = DynamicConnectivity::vertexNode(vertex2, level, false);
+    if ((node1 == -1) || (node2 == -1)) {
+        // a vertex without node is isolated in this forest
+        return(false);
+    }
+    return(DynamicConnectivity::findRoot(node1) == DynamicConnectivity::findRoot(node2));
+}
+
+/**
+ * Calculate the key of the edge (vertex1, vertex2), the order of the vertices does not matter.
+ *
+ * @param vertex1 index of the first vertex.
+ * @param vertex2 index of the second vertex.
+ *
+ * @return the key of the edge.
+ */
+long long DynamicConnectivity::edgeKey(int vertex1, int vertex2) {
+    if (vertex1 < vertex2) {
+        return(((long long) vertex2) * numberOfVertices + vertex1);
+    }
+    return(((long long) vertex1) * numberOfVertices + vertex2);
+}
+
+/**
+ * Calculate the key of the given direction of the given tree edge at the given level.
+ *
+ * @param edge the index of the edge.
+ * @param level the level of the forest.
+ * @param side 0: from vertex[0] to vertex[1], 1: reverse direction.
+ *
+ * @return the key of the node.
+ */
+long long DynamicConnectivity::arcKey(int edge, int level, int side) {
+    return((((long long) edge) * numberOfLevels + level) * 2 + side);
+}
+
+/**
+ * Insert the given tree edge into the forest of the given level.
+ *
+ * @param edge the index of the edge.
+ * @param level the level of the forest.
+ */
+void DynamicConnectivity::link(int edge, int level) {
+    int node1 = DynamicConnectivity::vertexNode(edges[edge].vertex[0], level, true);
+    int node2 = DynamicConnectivity::vertexNode(edges[edge].vertex[1], level, true);
+    int arc1 = DynamicConnectivity::createNode(-1);
+    int arc2 = DynamicConnectivity::createNode(-1);
+    arcTable->insert(DynamicConnectivity::arcKey(edge, level, 0), arc1);
+    arcTable->insert(DynamicConnectivity::arcKey(edge, level, 1), arc2);
+    // tour(vertex[0]), (vertex[0], vertex[1]), tour(vertex[1]), (vertex[1], vertex[0])
+    int tour1 = DynamicConnectivity::reroot(node1);
+    int tour2 = DynamicConnectivity::reroot(node2);
+    tour1 = DynamicConnectivity::concatenate(tour1, arc1);
+    tour1 = DynamicConnectivity::concatenate(tour1, tour2);
+    DynamicConnectivity::concatenate(tour1, arc2);
+}
+
+/**
+ * Remove the given tree edge from the forest of the given level.
+ *
+ * @param edge the index of the edge.
+ * @param level the level of the forest.
+ */
+void DynamicConnectivity::cut(int edge, int level) {
+    int arc1 = arcTable->find(DynamicConnectivity::arcKey(edge, level, 0));
+    int arc2 = arcTable->find(DynamicConnectivity::arcKey(edge, level, 1));
+    arcTable->erase(DynamicConnectivity::arcKey(edge, level, 0));
+    arcTable->erase(DynamicConnectivity::arcKey(edge, level, 1));
+    int root = DynamicConnectivity::findRoot(arc1);
+    int position1 = DynamicConnectivity::position(arc1);
+    int position2 = DynamicConnectivity::position(arc2);
+    if (position1 > position2) {
+        int helper = position1;
+        position1 = position2;
+        position2 = helper;
+    }
+    // the tour between both arcs is the tour of one tree, the rest is the other one
+    int front, arc, middle, back, rest;
+    DynamicConnectivity::split(root, position1, &front, &rest);
+    DynamicConnectivity::split(rest, 1, &arc, &rest);
+    DynamicConnectivity::split(rest, position2 - position1 - 1, &middle, &rest);
+    DynamicConnectivity::split(rest, 1, &arc, &back);
+    DynamicConnectivity::concatenate(front, back);
+    freeNodes.push_back(arc1);
+    freeNodes.push_back(arc2);
+}
+
+/**
+ * Insert the given edge into the edge lists of both vertices at the level of the edge.
+ *
+ * @param edge the index of the edge.
+ */
+void DynamicConnectivity::addToLists(int edge) {
+    unsigned char flag = edges[edge].isTree ? TREEEDGES : NONTREEEDGES;
+    for (int side = 0; side < 2; side++) {
+        int node = DynamicConnectivity::vertexNode(edges[edge].vertex[side], edges[edge].level, true);
+        int *head = edges[edge].isTree ? &nodes[node].treeHead : &nodes[node].nonTreeHead;
+        // the lists contain the sides of the edges: 2 * edge + side
+        edges[edge].previous[side] = -1;
+        edges[edge].next[side] = *head;
+        if (*head != -1) {
+            edges[*head >> 1].previous[*head & 1] = 2 * edge + side;
+        }
+        *head = 2 * edge + side;
+        if ((nodes[node].flags & flag) == 0) {
+            nodes[node].flags |= flag;
+            DynamicConnectivity::updatePath(node);
+        }
+    }
+}
+
+/**
+ * Remove the given edge from the edge lists of both vertices at the level of the edge.
+ *
+ * @param edge the index of the edge.
+ */
+void DynamicConnectivity::removeFromLists(int edge) {
+    unsigned char flag = edges[edge].isTree ? TREEEDGES : NONTREEEDGES;
+    for (int side = 0; side < 2; side++) {
+        int node = DynamicConnectivity::vertexNode(edges[edge].vertex[side], edges[edge].level, false);
+        int *head = edges[edge].isTree ? &nodes[node].treeHead : &nodes[node].nonTreeHead;
+        int previous = edges[edge].previous[side];
+        int next = edges[edge].next[side];
+        if (previous == -1) {
+            *head = next;
+        } else {
+            edges[previous >> 1].next[previous & 1] = next;
+        }
+        if (next != -1) {
+            edges[next >> 1].previous[next & 1] = previous;
+        }
+        if (*head == -1) {
+            nodes[node].flags &= ~flag;
+            DynamicConnectivity::updatePath(node);
+        }
+    }
+}
+
+/**
+ * Search a replacement for a removed tree edge at the given level. Before searching,
+ * the tree edges of the smaller tree are moved to the next level. Each non tree edge
+ * of the smaller tree, which is not a replacement, is moved to the next level as well.
+ *
+ * @param vertex1 index of the first vertex of the removed edge.
+ * @param vertex2 index of the second vertex of the removed edge.
+ * @param level the level of the forest.
+ *
+ * @return true: a replacement has been found, false: otherwise.
+ */
+bool DynamicConnectivity::replace(int vertex1, int vertex2, int level) {
+    int node1 = DynamicConnectivity::vertexNode(vertex1, level, false);
+    int node2 = DynamicConnectivity::vertexNode(vertex2, level, false);
+    if (nodes[DynamicConnectivity::findRoot(node1)].vertexCount
+        > nodes[DynamicConnectivity::findRoot(node2)].vertexCount) {
+        node1 = node2;
+    }
+    // node1 belongs to the smaller tree, which has at most N / 2^(level + 1) vertices
+    int node, edge, side;
+    while ((node = DynamicConnectivity::findFlagged(DynamicConnectivity::findRoot(node1), TREEEDGES)) != -1) {
+        edge = nodes[node].treeHead >> 1;
+        DynamicConnectivity::removeFromLists(edge);
+        edges[edge].level++;
+        DynamicConnectivity::addToLists(edge);
+        DynamicConnectivity::link(edge, edges[edge].level);
+    }
+    while ((node = DynamicConnectivity::findFlagged(DynamicConnectivity::findRoot(node1), NONTREEEDGES)) != -1) {
+        edge = nodes[node].nonTreeHead >> 1;
+        side = nodes[node].nonTreeHead & 1;
+        DynamicConnectivity::removeFromLists(edge);
+        if (DynamicConnectivity::findRoot(DynamicConnectivity::vertexNode(edges[edge].vertex[1 - side], level, false))
+            != DynamicConnectivity::findRoot(node1)) {
+            // the edge reconnects both trees
+            edges[edge].isTree = true;
+            DynamicConnectivity::addToLists(edge);
+            for (int i = 0; i <= level; i++) {
+                DynamicConnectivity::link(edge, i);
+            }
+            return(true);
+        }
+        edges[edge].level++;
+        DynamicConnectivity::addToLists(edge);
+    }
+    return(false);
+}
+
+/**
+ * Add a component of the given size to the multiset of sizes.
+ *
+ * @param size the size of the component.
+ */
+void DynamicConnectivity::addSize(int size) {
+    sizeCounter[size]++;
+    if (size > largestComponentSize) {
+        largestComponentSize = size;
+    }
+}
+
+/**
+ * Remove a component of the given size from the multiset of sizes.
+ *
+ * @param size the size of the component.
+ */
+void DynamicConnectivity::removeSize(int size) {
+    sizeCounter[size]--;
+    while ((largestComponentSize > 0) && (sizeCounter[largestComponentSize] == 0)) {
+        largestComponentSize--;
+    }
+}
@@ -0,0 +1,352 @@
+/*
+ * dynamicConnectivity.h
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DYNAMICCONNECTIVITY_H_INCLUDED
+#define DYNAMICCONNECTIVITY_H_INCLUDED
+
+#include <vector>
+
+#include "adjacencyList.h"
+
+/**
+ * Define a node of an Euler tour. The tours are stored in treaps, which are ordered
+ * by the position in the tour. A node represents either a vertex (once per tour)
+ * or one direction of a tree edge.
+ */
+struct tourNode {
+    int left;
+    int right;
+    int parent;
+    unsigned int priority;
+    int nodeCount;
+    int vertexCount;
+    int vertex;
+    int treeHead;
+    int nonTreeHead;
+    unsigned char flags;
+    unsigned char subtreeFlags;
+};
+
+/**
+ * Define an edge of the dynamic connectivity structure. Each edge is contained
+ * in the edge lists of both vertices at its level, side 0 belongs to vertex[0]
+ * and side 1 to vertex[1].
+ */
+struct connectivityEdge {
+    int vertex[2];
+    int level;
+    bool isTree;
+    int next[2];
+    int previous[2];
+};
+
+/**
+ * Define a fully dynamic connectivity structure for undirected graphs following
+ * Holm, de Lichtenberg and Thorup. Each edge has a level in [0, log2(N)], the tree edges
+ * of level >= i form the spanning forest F_i, which is stored as Euler tours.
+ * Inserting an edge costs O(log N), removing an edge costs amortized O(log^2 N).
+ * The sizes of all components are kept in a multiset, such that the size of the
+ * largest component is available in O(1).
+ * Loops do not change the components, hence they are ignored.
+ */
+class DynamicConnectivity {
+public:
+    /**
+     * Constructor for setting up the structure of an empty graph.
+     *
+     * @param n number of vertices.
+     */
+    DynamicConnectivity(int n);
+
+    /**
+     * Destructor.
+     */
+    ~DynamicConnectivity();
+
+    /**
+     * Remove all edges.
+     */
+    void reset();
+
+    /**
+     * Insert the edge (vertex1, vertex2), which must not exist yet.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     */
+    void insertEdge(int vertex1, int vertex2);
+
+    /**
+     * Remove the edge (vertex1, vertex2), which must exist.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     */
+    void removeEdge(int vertex1, int vertex2);
+
+    /**
+     * Test whether both vertices belong to the same component.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     *
+     * @return true: same component, false: otherwise.
+     */
+    bool connected(int vertex1, int vertex2);
+
+    /**
+     * Return the size of the component of the given vertex.
+     *
+     * @param vertex the index of the given vertex.
+     *
+     * @return the size of the component.
+     */
+    int getComponentSize(int vertex);
+
+    /**
+     * Return the number of components.
+     *
+     * @return the number of components.
+     */
+    int getNumberOfComponents();
+
+    /**
+     * Return the size of the largest component.
+     *
+     * @return the size of the largest component.
+     */
+    int getSizeOfLargestComponent();
+
+    /**
+     * Return how many components have the given size.
+     *
+     * @param size the size of the components, between 0 and n.
+     *
+     * @return the number of components of the given size.
+     */
+    int getNumberOfComponentsOfSize(int size);
+
+private:
+    int numberOfVertices;
+    int numberOfLevels;
+    std::vector<tourNode> nodes;
+    std::vector<int> freeNodes;
+    std::vector<connectivityEdge> edges;
+    std::vector<int> freeEdges;
+    PositionTable *edgeTable;
+    PositionTable *vertexNodeTable;
+    PositionTable *arcTable;
+    int *sizeCounter;
+    int numberOfComponents;
+    int largestComponentSize;
+    unsigned int priorityState;
+
+    /**
+     * Create a new node of an Euler tour.
+     *
+     * @param vertex the index of the vertex or -1, if the node represents a tree edge.
+     *
+     * @return the index of the node.
+     */
+    int createNode(int vertex);
+
+    /**
+     * Return the node of the given vertex in the forest of the given level.
+     *
+     * @param vertex the index of the given vertex.
+     * @param level the level of the forest.
+     * @param create true: create the node, if it does not exist yet.
+     *
+     * @return the index of the node or -1, if it does not exist.
+     */
+    int vertexNode(int vertex, int level, bool create);
+
+    /**
+     * Recalculate the counters and flags of the given node from its children.
+     *
+     * @param node the index of the given node.
+     */
+    void update(int node);
+
+    /**
+     * Recalculate the counters and flags from the given node up to the root.
+     *
+     * @param node the index of the given node.
+     */
+    void updatePath(int node);
+
+    /**
+     * Concatenate both tours.
+     *
+     * @param tour1 the root of the first tour or -1.
+     * @param tour2 the root of the second tour or -1.
+     *
+     * @return the root of the concatenated tour.
+     */
+    int concatenate(int tour1, int tour2);
+
+    /**
+     * Merge both treaps, auxiliary function of concatenate.
+     *
+     * @param tour1 the root of the first treap or -1.
+     * @param tour2 the root of the second treap or -1.
+     *
+     * @return the root of the merged treap.
+     */
+    int merge(int tour1, int tour2);
+
+    /**
+     * Split the tour, such that the first part contains the given number of nodes.
+     *
+     * @param tour the root of the tour.
+     * @param count the number of nodes of the first part.
+     * @param first pointer to the root of the first part.
+     * @param second pointer to the root of the second part.
+     */
+    void split(int tour, int count, int *first, int *second);
+
+    /**
+     * Return the root of the tour of the given node.
+     *
+     * @param node the index of the given node.
+     *
+     * @return the root of the tour.
+     */
+    int findRoot(int node);
+
+    /**
+     * Return the position of the given node in its tour.
+     *
+     * @param node the index of the given node.
+     *
+     * @return the position starting at zero.
+     */
+    int position(int node);
+
+    /**
+     * Rotate the tour, such that it starts at the given node.
+     *
+     * @param node the index of the given node.
+     *
+     * @return the root of the rotated tour.
+     */
+    int reroot(int node);
+
+    /**
+     * Return a node with the given flag in the given tour.
+     *
+     * @param tour the root of the tour.
+     * @param flag the flag to search for.
+     *
+     * @return the index of the node or -1, if there is no such node.
+     */
+    int findFlagged(int tour, unsigned char flag);
+
+    /**
+     * Test whether both vertices are connected in the forest of the given level.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     * @param level the level of the forest.
+     *
+     * @return true: connected, false: otherwise.
+     */
+    bool connectedAtLevel(int vertex1, int vertex2, int level);
+
+    /**
+     * Calculate the key of the edge (vertex1, vertex2), the order of the vertices does not matter.
+     *
+     * @param vertex1 index of the first vertex.
+     * @param vertex2 index of the second vertex.
+     *
+     * @return the key of the edge.
+     */
+    long long edgeKey(int vertex1, int vertex2);
+
+    /**
+     * Calculate the key of the given direction of the given tree edge at the given level.
+     *
+     * @param edge the index of the edge.
+     * @param level the level of the forest.
+     * @param side 0: from vertex[0] to vertex[1], 1: reverse direction.
+     *
+     * @return the key of the node.
+     */
+    long long arcKey(int edge, int level, int side);
+
+    /**
+     * Insert the given tree edge into the forest of the given level.
+     *
+     * @param edge the index of the edge.
+     * @param level the level of the forest.
+     */
+    void link(int edge, int level);
+
+    /**
+     * Remove the given tree edge from the forest of the given level.
+     *
+     * @param edge the index of the edge.
+     * @param level the level of the forest.
+     */
+    void cut(int edge, int level);
+
+    /**
+     * Insert the given edge into the edge lists of both vertices at the level of the edge.
+     *
+     * @param edge the index of the edge.
+     */
+    void addToLists(int edge);
+
+    /**
+     * Remove the given edge from the edge lists of both vertices at the level of the edge.
+     *
+     * @param edge the index of the edge.
+     */
+    void removeFromLists(int edge);
+
+    /**
+     * Search a replacement for a removed tree edge at the given level. Before searching,
+     * the tree edges of the smaller tree are moved to the next level. Each non tree edge
+     * of the smaller tree, which is not a replacement, is moved to the next level as well.
+     *
+     * @param vertex1 index of the first vertex of the removed edge.
+     * @param vertex2 index of the second vertex of the removed edge.
+     * @param level the level of the forest.
+     *
+     * @return true: a replacement has been found, false: otherwise.
+     */
+    bool replace(int vertex1, int vertex2, int level);
+
+    /**
+     * Add a component of the given size to the multiset of sizes.
+     *
+     * @param size the size of the component.
+     */
+    void addSize(int size);
+
+    /**
+     * Remove a component of the given size from the multiset of sizes.
+     *
+     * @param size the size of the component.
+     */
+    void removeSize(int size);
+};
+
+#endif // DYNAMICCONNECTIVITY_H_INCLUDED
@@ -20,6 +20,8 @@
 
 #include "er.h"
 
+#include <math.h>
+
 /**
  * Constructor for setting up an empty ER graph.
  *
@@ -28,11 +30,17 @@
  * @param generator a random number generator
  * @param digraph true (default): digraph, false: no digraph
  * @param loopsAllowed true (default): loops enabled, false: loops disabled
+ * @param storage ADJACENCYMATRIX (default), ADJACENCYLIST or BITMATRIX
+ * @param components COMPONENTSEARCH (default), COMPONENTTRACKING or DYNAMICCONNECTIVITY
+ * @param digraphComponents REACHABLECOMPONENTS (default), WEAKCOMPONENTS or STRONGCOMPONENTS
  */
-ER::ER(double c, int n, RandomGenerator* generator, bool digraph, bool loopsAllowed)
-: AbstractGraph(n, generator, digraph, loopsAllowed) { // call super constructor
+ER::ER(double c, int n, RandomGenerator* generator, bool digraph, bool loopsAllowed, int storage,
+       int components, int digraphComponents)
+: RandomGraph<ER>(n, generator, digraph, loopsAllowed, storage, components, digraphComponents) { // call super constructor
     connectivity = c;
     probability = c/((double) n);
+    // log(1 - p) for the geometric skips, p > 1 means that all edges are inserted
+    logComplement = (probability < 1.0) ? log(1.0 - probability) : -HUGE_VAL;
 }
 
 /**
@@ -40,21 +48,3 @@ ER::ER(double c, int n, RandomGenerator* generator, bool digraph, bool loopsAllo
  */
 ER::~ER() {
 }
-
-/**
- * Should the edge (vertex1, vertex2) be inserted?
- * This function is abstract and must be implemented by inheriting classes.
- *
- * @param vertex1 index of the head of the proposed edge
- * @param vertex2 index of the target of the propose edge
- *
- * @return true: insert the proposed edge;
- *    false: do not insert the proposed edge
- */
-bool ER::mustInsertEdge(int vertex1, int vertex2) {
-    if (randomGenerator->randomNumber() <= probability) {
-        return(true);
-    } else {
-        return(false);
-    }
-}
@@ -21,12 +21,12 @@
 #ifndef ER_H_INCLUDED
 #define ER_H_INCLUDED
 
-#include "abstractGraph.h" // Base class: AbstractGraph
+#include "randomGraph.h" // Base class: RandomGraph
 
 /**
- * Define an Erdos-Renyi random graph based on AbstractGraph.
+ * Define an Erdos-Renyi random graph based on RandomGraph, which is the model with one block.
  */
-class ER : public AbstractGraph {
+class ER : public RandomGraph<ER> {
 
 public:
 	/**
@@ -37,27 +37,19 @@ public:
      * @param generator a random number generator
      * @param digraph true (default): digraph, false: no digraph
      * @param loopsAllowed true (default): loops enabled, false: loops disabled
+     * @param storage ADJACENCYMATRIX (default), ADJACENCYLIST or BITMATRIX
+     * @param components COMPONENTSEARCH (default), COMPONENTTRACKING or DYNAMICCONNECTIVITY
+     * @param digraphComponents REACHABLECOMPONENTS (default), WEAKCOMPONENTS or STRONGCOMPONENTS
      */
     ER(double c, int n, RandomGenerator* generator,
-        bool digraph = false, bool loopsAllowed = false);
+        bool digraph = false, bool loopsAllowed = false, int storage = ADJACENCYMATRIX,
+        int components = COMPONENTSEARCH, int digraphComponents = REACHABLECOMPONENTS);
 
     /**
      * Destructor.
      */
     ~ER();
 
-    /**
-     * Should the edge (vertex1, vertex2) be inserted?
-     * This function is abstract and must be implemented by inheriting classes.
-     *
-     * @param vertex1 index of the head of the proposed edge
-     * @param vertex2 index of the target of the propose edge
-     *
-     * @return true: insert the proposed edge;
-     *    false: do not insert the proposed edge
-     */
-    virtual bool mustInsertEdge(int vertex1, int vertex2);
-
     /**
      * This function returns the connectivity of the graph.
      *
@@ -78,9 +70,83 @@ public:
         return(probability);
     }
 
+    /**
+     * The model of RandomGraph: all vertices belong to one block.
+     *
+     * @return the number of blocks
+     */
+    inline int getNumberOfBlocks()
+    {
+        return(1);
+    }
+
+    /**
+     * The model of RandomGraph: return the number of vertices of the given block.
+     *
+     * @param block index of the block
+     *
+     * @return the number of vertices of the block
+     */
+    inline int getBlockSize(int block)
+    {
+        return(getNumberOfVertices());
+    }
+
+    /**
+     * The model of RandomGraph: return the vertex with the given index in the given block.
+     *
+     * @param block index of the block
+     * @param index index of the vertex in the block
+     *
+     * @return the index of the vertex
+     */
+    inline int getBlockMember(int block, int index)
+    {
+        return(index);
+    }
+
+    /**
+     * The model of RandomGraph: return the block of the given vertex.
+     *
+     * @param vertex index of the vertex
+     *
+     * @return the index of the block
+     */
+    inline int getBlock(int vertex)
+    {
+        return(0);
+    }
+
+    /**
+     * The model of RandomGraph: return log(1 - p) for the edges between both blocks.
+     *
+     * @param block1 index of the first block
+     * @param block2 index of the second block
+     *
+     * @return log(1 - p), where p is the probability of an edge
+     */
+    inline double getLogComplement(int block1, int block2)
+    {
+        return(logComplement);
+    }
+
+    /**
+     * The model of RandomGraph: return the probability of the edges between both blocks.
+     *
+     * @param block1 index of the first block
+     * @param block2 index of the second block
+     *
+     * @return p, the probability of an edge
+     */
+    inline double getProbability(int block1, int block2)
+    {
+        return(probability);
+    }
+
 private:
     double connectivity;
     double probability;
+    double logComplement;
 };
 
 #endif // ER_H_INCLUDED
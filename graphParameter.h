@@ -32,6 +32,9 @@ public:
     double connectivity;
     double secondConnectivity;
     int numberOfBlocks;
+    int storage;
+    int components;
+    int digraphComponents;
 
     /**
      * The default constructor makes sure, that all parameter have
@@ -43,6 +46,9 @@ public:
         connectivity = 0.0;
         secondConnectivity = 0.0;
         numberOfBlocks = 0;
+        storage = 0;
+        components = 0;
+        digraphComponents = 0;
     }
 };
 
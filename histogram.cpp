@@ -23,10 +23,12 @@
 /**
  * Constructor for the historgram: Allocate memory and set the histogram range.
  *
- * @param maxSize, maximum size of the largest component.
+ * @param minValue, the smallest value of the histogram.
+ * @param maxValue, the biggest value of the histogram.
  */
-Histogram::Histogram(int maxSize) {
-    sizeOfHistogram = maxSize;
+Histogram::Histogram(int minValue, int maxValue) {
+    smallestValue = minValue;
+    sizeOfHistogram = maxValue - minValue + 1;
     histogram = new int[sizeOfHistogram];
     Histogram::resetHistogram();
 }
@@ -46,13 +48,25 @@ Histogram::~Histogram() {
  * @exception invalid given value.
  */
 void Histogram::increment(int x) {
-    if ((x < 1) || (x > sizeOfHistogram)) {
+    if ((x < smallestValue) || (x >= smallestValue + sizeOfHistogram)) {
         perror("Invalid given value x = " + x);
     }
-    histogram[x - 1] = histogram[x - 1] + 1;
+    histogram[x - smallestValue] = histogram[x - smallestValue] + 1;
     numberOfCounts++;
 }
 
+/**
+ * Add the entries of the given histogram, which must have the same range.
+ *
+ * @param other, pointer to the given histogram.
+ */
+void Histogram::addHistogram(Histogram *other) {
+    for (int i = 0; i < sizeOfHistogram; i++) {
+        histogram[i] = histogram[i] + other->histogram[i];
+    }
+    numberOfCounts = numberOfCounts + other->numberOfCounts;
+}
+
 /**
  * Save the histogram to a dat-text file.
  *
@@ -75,7 +89,7 @@ void Histogram::saveHistogram(const std::string directory, const std::string fil
                     // N = number of counts
             p = ((double) histogram[i]) / ((double) numberOfCounts);
             err = sqrt(((double) p * (1.0 - (double) p)) / ((double) numberOfCounts - 1.0));
-            outfile << (i + 1) << " " << histogram[i] << " " << err << std::endl;
+            outfile << (i + smallestValue) << " " << histogram[i] << " " << err << std::endl;
         }
     }
     outfile.close();
@@ -123,7 +137,7 @@ bool Histogram::isHistogramFlatEnough(double epsilon, int lowerBound, int upperB
  * @return True: All bins are non zero; false: There exist bin(s) that are zero.
  */
 bool Histogram::areAllBinsNonZero(int lowerBound, int upperBound) {
-    for (int i = (lowerBound - 1); i < upperBound; i++) {
+    for (int i = (lowerBound - smallestValue); i <= (upperBound - smallestValue); i++) {
         if (histogram[i] == 0) {
             return(false);
         }
@@ -140,8 +154,8 @@ bool Histogram::areAllBinsNonZero(int lowerBound, int upperBound) {
  * @return the height of the smallest bin.
  */
 int Histogram::minimumValue(int lowerBound, int upperBound) {
-    int smallestBin = histogram[(lowerBound - 1)];
-    for (int i = (lowerBound - 1); i < upperBound; i++) {
+    int smallestBin = histogram[(lowerBound - smallestValue)];
+    for (int i = (lowerBound - smallestValue); i <= (upperBound - smallestValue); i++) {
         if (histogram[i] < smallestBin) {
             smallestBin = histogram[i];
         }
@@ -32,9 +32,10 @@ public:
     /**
      * Constructor for the historgram: Allocate memory and set the histogram range.
      *
-     * @param maxSize, maximum size of the largest component.
+     * @param minValue, the smallest value of the histogram.
+     * @param maxValue, the biggest value of the histogram.
      */
-    Histogram(int maxSize);
+    Histogram(int minValue, int maxValue);
 
     /**
      * Destructor: Free the histogram.
@@ -50,6 +51,13 @@ public:
      */
     void increment(int x);
 
+    /**
+     * Add the entries of the given histogram, which must have the same range.
+     *
+     * @param other, pointer to the given histogram.
+     */
+    void addHistogram(Histogram *other);
+
     /**
      * Save the histogram to a dat-text file.
      *
@@ -88,6 +96,7 @@ public:
 
 private:
     int *histogram;
+    int smallestValue; // the value of the first bin
     int sizeOfHistogram;
     int numberOfCounts;
 
@@ -40,6 +40,14 @@
  *                 argv[6]: interblock connectivity
  *                 argv[7]: intrablock connectivity
  *                 argv[8]: seed
+ *             2.) Compare the costs of obtaining the components on an ER graph:
+ *                 argv[2]: number of vertices
+ *                 argv[3]: connectivity
+ *                 argv[4]: number of steps
+ *                 argv[5]: seed
+ *             3.) Check the empty and the complete ER and SBM graphs at the limits of the connectivity:
+ *                 argv[2]: number of vertices
+ *                 argv[3]: seed
  */
 int main(int argc, char** argv) {
     if (argc == 1) {
@@ -55,6 +63,12 @@ int main(int argc, char** argv) {
         graph->generateRandom();
         graph->saveGraphToGraphviz(argv[2], argv[3]);
         std::cout << graph->getSizeOfLargestComponent() << std::endl;
+    } else if (atoi(argv[1]) == 2) {
+        // compare depth-first search, incremental tracking and dynamic connectivity
+        benchmarkComponents(atoi(argv[2]), atof(argv[3]), atoi(argv[4]), strtoull(argv[5], NULL, 10));
+    } else if (atoi(argv[1]) == 3) {
+        // c = 0 has to yield the empty graph and c = n the complete graph
+        checkLimits(atoi(argv[2]), strtoull(argv[3], NULL, 10));
     } else {
         // treat error case
         perror("Invalid given arguments");
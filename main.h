@@ -21,6 +21,7 @@
 #ifndef MAIN_H_INCLUDED
 #define MAIN_H_INCLUDED
 
+#include <ctime>
 #include <iostream>
 #include <stdlib.h>
 
@@ -93,7 +94,7 @@ int enterNumberOfSamples(std::string input) {
 void setup() {
     std::string helper;
     int n, generator, graph, value;
-    unsigned short int seed;
+    unsigned long long int seed;
     param = new GraphParameter();
 
     //std::cout << "is digraph y/n" << std::endl;
@@ -119,6 +120,8 @@ void setup() {
 
     //std::cout << "enter the number of the generator to use:" << std::endl;
     //std::cout << "  0: default generator" << std::endl;
+    //std::cout << "  1: xoshiro256** generator" << std::endl;
+    //std::cout << "  2: Philox generator" << std::endl;
     std::cin >> generator; //############################################################################################# s5
 
     //std::cout << "enter a seed for the random number generator:" << std::endl;
@@ -126,6 +129,11 @@ void setup() {
 
     //std::cout << "enter the value to use:" << std::endl;
     //std::cout << "  0: largest component" << std::endl;
+    //std::cout << "  1: second largest component" << std::endl;
+    //std::cout << "  2: number of components" << std::endl;
+    //std::cout << "  3: number of isolated vertices" << std::endl;
+    //std::cout << "  4: number of edges" << std::endl;
+    //std::cout << "  5: size of the 2-core (no digraphs)" << std::endl;
     std::cin >> value; //################################################################################################# s7
 
     //std::cout << "enter the number of the graph to use:" << std::endl;
@@ -150,6 +158,26 @@ void setup() {
         exit(EXIT_FAILURE);
     }
 
+    //std::cout << "enter the storage of the edges:" << std::endl;
+    //std::cout << "  0: adjacency matrix" << std::endl;
+    //std::cout << "  1: adjacency list" << std::endl;
+    //std::cout << "  2: bit-packed adjacency matrix" << std::endl;
+    std::cin >> param->storage; //######################################################################################## s12
+
+    //std::cout << "enter how the components are obtained:" << std::endl;
+    //std::cout << "  0: depth-first search after each change" << std::endl;
+    //std::cout << "  1: incremental tracking (undirected graphs only)" << std::endl;
+    //std::cout << "  2: dynamic connectivity (undirected graphs only)" << std::endl;
+    std::cin >> param->components; //##################################################################################### s13
+
+    if (param->isDigraph) {
+        //std::cout << "enter the components of the digraph:" << std::endl;
+        //std::cout << "  0: reachable from the start vertices (depends on the order)" << std::endl;
+        //std::cout << "  1: weakly connected components" << std::endl;
+        //std::cout << "  2: strongly connected components" << std::endl;
+        std::cin >> param->digraphComponents; //########################################################################## s14
+    }
+
     sim = new MCPresenter(param, helper, n, seed, generator, graph, value);
 }
 
@@ -161,6 +189,26 @@ void simpleSampling() {
     sim->simpleSampling(samples); //###################################################################################### ss1
 }
 
+/**
+ * Perform simple sampling using multiple threads.
+ */
+void threadedSimpleSampling() {
+    int samples = enterNumberOfSamples("simple sampling"); //############################################################# tss1
+    int threads = enterNumberOfSamples("threads"); //##################################################################### tss2
+    sim->simpleSampling(samples, threads);
+}
+
+/**
+ * Perform simple sampling of ER graphs for all numbers of edges using the Newman-Ziff algorithm.
+ */
+void newmanZiff() {
+    double maximumConnectivity;
+    int samples = enterNumberOfSamples("the Newman-Ziff algorithm"); //################################################### nz1
+    //std::cout << "enter the maximum connectivity" << std::endl;
+    std::cin >> maximumConnectivity; //################################################################################### nz2
+    sim->newmanZiff(samples, maximumConnectivity);
+}
+
 /**
  * Use the Metropolis algorithm.
  */
@@ -202,6 +250,66 @@ void wangLandauAlgorithm() {
     sim->wangLandauAlgorithm(lowerBound, upperBound, sweepsToEvaluate, modiFacFinal);
 }
 
+/**
+ * Use the Metropolis algorithm with parallel tempering.
+ */
+void parallelTempering() {
+    int numberOfTemperatures, samples, equi, exchange;
+    //std::cout << "enter the number of temperatures" << std::endl;
+    std::cin >> numberOfTemperatures; //################################################################################## pt1
+    double *temperatures = new double[numberOfTemperatures];
+    for (int i = 0; i < numberOfTemperatures; i++) {
+        temperatures[i] = enterTemperature(); //########################################################################## pt2
+    }
+    samples = enterNumberOfSamples("importance sampling"); //############################################################# pt3
+    equi = enterNumberOfSamples("equilibration steps"); //################################################################ pt4
+    exchange = enterNumberOfSamples("sweeps between the exchanges"); //################################################### pt5
+    sim->parallelTempering(temperatures, numberOfTemperatures, samples, equi, exchange);
+    delete [] temperatures;
+}
+
+/**
+ * Use the Wang-Landau algorithm with replica exchanges between overlapping windows.
+ */
+void replicaExchangeWangLandau() {
+    int numberOfWindows, sweepsToEvaluate, exchange;
+    double modiFacFinal;
+    //std::cout << "enter the number of windows" << std::endl;
+    std::cin >> numberOfWindows; //####################################################################################### rewl1
+    int *lowerBounds = new int[numberOfWindows];
+    int *upperBounds = new int[numberOfWindows];
+    for (int i = 0; i < numberOfWindows; i++) {
+        //std::cout << "enter lower bound and upper bound of the window" << std::endl;
+        std::cin >> lowerBounds[i] >> upperBounds[i]; //################################################################## rewl2
+    }
+    //std::cout << "enter the number of sweeps for the evaluation" << std::endl;
+    std::cin >> sweepsToEvaluate; //###################################################################################### rewl3
+    //std::cout << "enter the final modification factor" << std::endl;
+    std::cin >> modiFacFinal; //########################################################################################## rewl4
+    exchange = enterNumberOfSamples("sweeps between the exchanges"); //################################################### rewl5
+    sim->replicaExchangeWangLandau(lowerBounds, upperBounds, numberOfWindows, sweepsToEvaluate, modiFacFinal, exchange);
+    delete [] lowerBounds;
+    delete [] upperBounds;
+}
+
+/**
+ * Use the Wang-Landau algorithm with multiple walkers in one window.
+ */
+void multipleWalkerWangLandau() {
+    int lowerBound, upperBound, sweepsToEvaluate, walkers;
+    double modiFacFinal;
+    //std::cout << "enter lower bound" << std::endl;
+    std::cin >> lowerBound; //############################################################################################ mwl1
+    //std::cout << "enter upper bound" << std::endl;
+    std::cin >> upperBound; //############################################################################################ mwl2
+    //std::cout << "enter the number of sweeps for the evaluation" << std::endl;
+    std::cin >> sweepsToEvaluate; //###################################################################################### mwl3
+    //std::cout << "enter the final modification factor" << std::endl;
+    std::cin >> modiFacFinal; //########################################################################################## mwl4
+    walkers = enterNumberOfSamples("walkers"); //######################################################################### mwl5
+    sim->multipleWalkerWangLandau(lowerBound, upperBound, sweepsToEvaluate, modiFacFinal, walkers);
+}
+
 /**
  * Choose the action which has to be done.
  */
@@ -212,6 +320,11 @@ void chooseAction() {
     //std::cout << "  1: Metropolis algorithm" << std::endl;
     //std::cout << "  2: equilibrate" << std::endl;
     //std::cout << "  3: Wang-Landau algorithm" << std::endl;
+    //std::cout << "  4: parallel tempering" << std::endl;
+    //std::cout << "  5: replica-exchange Wang-Landau algorithm" << std::endl;
+    //std::cout << "  6: multiple walker Wang-Landau algorithm" << std::endl;
+    //std::cout << "  7: simple sampling using multiple threads" << std::endl;
+    //std::cout << "  8: Newman-Ziff algorithm (ER graphs only)" << std::endl;
     std::cin >> action; //############################################################################################### c1
     if (action == 0) {
         simpleSampling();
@@ -221,7 +334,104 @@ void chooseAction() {
         equilibrate();
     } else if (action == 3) {
         wangLandauAlgorithm();
+    } else if (action == 4) {
+        parallelTempering();
+    } else if (action == 5) {
+        replicaExchangeWangLandau();
+    } else if (action == 6) {
+        multipleWalkerWangLandau();
+    } else if (action == 7) {
+        threadedSimpleSampling();
+    } else if (action == 8) {
+        newmanZiff();
+    }
+}
+
+/**
+ * Compare the costs of obtaining the components. For each method an ER graph
+ * is stored as adjacency list and the given number of steps is performed, where each step
+ * proposes a candidate graph, evaluates the size of its largest component and rejects
+ * the candidate graph with probability 1/2. The seed is the same for all methods,
+ * such that all of them process the same graphs.
+ *
+ * @param n number of vertices.
+ * @param connectivity the connectivity of the ER graph.
+ * @param steps the number of steps.
+ * @param seed the seed of the random number generator.
+ */
+void benchmarkComponents(int n, double connectivity, int steps, unsigned long long seed) {
+    std::string names[] = {"depth-first search", "incremental tracking", "dynamic connectivity"};
+    for (int components = COMPONENTSEARCH; components <= DYNAMICCONNECTIVITY; components++) {
+        RandomGenerator *gen = new RandomGenerator(seed);
+        ER *graph = new ER(connectivity, n, gen, false, false, ADJACENCYLIST, components);
+        graph->generateRandom();
+        double sum = 0.0;
+        clock_t start = clock();
+        for (int i = 0; i < steps; i++) {
+            graph->proposeCandidateGraph();
+            sum += graph->evaluateCandidateGraph();
+            if (gen->randomNumber() < 0.5) {
+                graph->rejectCandidateGraph();
+            } else {
+                graph->acceptCandidateGraph();
+            }
+        }
+        double seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+        std::cout << names[components] << ": " << (1000.0 * seconds / steps) << " ms per step, "
+                  << "mean size of the largest component " << (sum / steps) << std::endl;
+        delete graph;
+        delete gen;
+    }
+}
+
+/**
+ * Check the limits of the connectivity for each storage, with and without digraph and loops:
+ * an ER graph with c = 0 has to be empty and an ER graph with c = n (p = 1) has to be complete.
+ * A SBM graph with disjoint blocks and the intrablock connectivity n has to consist of complete
+ * blocks, also after accepting a candidate graph.
+ *
+ * @param n number of vertices.
+ * @param seed the seed of the random number generator.
+ *
+ * @exception a graph, whose number of edges differs from the expected one.
+ */
+void checkLimits(int n, unsigned long long seed) {
+    RandomGenerator *gen = new RandomGenerator(seed);
+    for (int storage = ADJACENCYMATRIX; storage <= BITMATRIX; storage++) {
+        for (int digraph = 0; digraph <= 1; digraph++) {
+            for (int loops = 0; loops <= 1; loops++) {
+                long long pairs = ((long long) n) * (n - 1) / (digraph ? 1 : 2) + (loops ? n : 0);
+                ER *empty = new ER(0.0, n, gen, digraph, loops, storage);
+                ER *complete = new ER(n, n, gen, digraph, loops, storage);
+                empty->generateRandom();
+                complete->generateRandom();
+                if ((empty->getNumberOfEdges() != 0) || (complete->getNumberOfEdges() != pairs)) {
+                    perror(("Wrong number of edges of the ER graphs with storage " + numToStr(storage)
+                            + ", digraph " + numToStr(digraph) + " and loops " + numToStr(loops)).c_str());
+                    exit(EXIT_FAILURE);
+                }
+                delete empty;
+                delete complete;
+                SBM *blocks = new SBM(0.0, n, 5, n, gen, digraph, loops, storage);
+                blocks->generateRandom();
+                blocks->proposeCandidateGraph();
+                blocks->acceptCandidateGraph();
+                pairs = 0;
+                for (int b = 0; b < 5; b++) {
+                    long long size = blocks->getBlockSize(b);
+                    pairs += size * (size - 1) / (digraph ? 1 : 2) + (loops ? size : 0);
+                }
+                if (blocks->getNumberOfEdges() != pairs) {
+                    perror(("Wrong number of edges of the SBM graph with storage " + numToStr(storage)
+                            + ", digraph " + numToStr(digraph) + " and loops " + numToStr(loops)).c_str());
+                    exit(EXIT_FAILURE);
+                }
+                delete blocks;
+            }
+        }
     }
+    delete gen;
+    std::cout << "All limits passed" << std::endl;
 }
 
 /**
@@ -27,18 +27,20 @@
  * @param d, where the file should be saved.
  * @param n, number of vertices.
  * @param seed, the seed for the random number generator.
- * @param generatorNumber, the generator to use, default is 0 == RandomGenerator().
+ * @param generatorNumber, the generator to use, default is 0 == drand48 LCG, 1 == xoshiro256**, 2 == Philox.
  * @param graphNumber, the graph to use, default is 0 == ER random graph.
  * @param valueNumber, the value to use for the algorithm, default is 0 == largest component.
  */
-MCPresenter::MCPresenter(GraphParameter *p, std::string d, int n, unsigned short int seed,
+MCPresenter::MCPresenter(GraphParameter *p, std::string d, int n, unsigned long long int seed,
                          int generatorNumber, int graphNumber, int valueNumber){
     parameter = p;
     whichGenerator = generatorNumber;
     whichGraph = graphNumber;
     whichValue = valueNumber;
     numberOfVertices = n;
+    generatorSeed = seed;
     generator = MCPresenter::initRandomGenerator(seed);
+    observable = MCPresenter::initObservable();
     simulation = new MCSimulation(d, this);
 }
 
@@ -47,6 +49,7 @@ MCPresenter::MCPresenter(GraphParameter *p, std::string d, int n, unsigned short
  */
 MCPresenter::~MCPresenter() {
     delete generator;
+    delete observable;
     delete simulation;
 }
 
@@ -56,33 +59,33 @@ MCPresenter::~MCPresenter() {
  * @param graph, pointer to the given graph.
  *
  * @return The value of interest for the given graph.
- *
- * @exception invalid value in whichValue.
  */
 double MCPresenter::getValueOfInterest(AbstractGraph *graph) {
-    if (whichValue == GETLARGESTCOMPONENTSIZE) {
-        return (graph->getSizeOfLargestComponent());
-    } else {
-        perror("Invalid whichValue " + whichValue);
-        exit(EXIT_FAILURE);
-    }
+    return (observable->getValue(graph));
 }
 
 /**
- * Provide some further statistics.
+ * Get the value of interest from the proposed candidate graph of the given graph.
+ * The calculation may stop, as soon as the value exceeds the given bound.
  *
- * @param outfile, reference to the outfile-object to save the statistics.
  * @param graph, pointer to the given graph.
+ * @param bound, the maximum value, which is of interest.
  *
- * @exception invalid value in whichValue.
+ * @return The value of interest for the candidate graph or a value bigger than the bound.
  */
-void MCPresenter::printStatistics(std::ofstream& outfile, AbstractGraph *graph) {
-    if (whichValue == GETLARGESTCOMPONENTSIZE) {
-        outfile << graph->getNumberOfComponents() << " " << graph->getNumberOfEdges();
-    } else {
-        perror("Invalid whichValue " + whichValue);
-        exit(EXIT_FAILURE);
-    }
+double MCPresenter::getCandidateValueOfInterest(AbstractGraph *graph, double bound) {
+    // the values are integers, larger bounds do not stop the calculation
+    return (observable->getCandidateValue(graph, (bound < INT_MAX) ? (int) floor(bound) : INT_MAX));
+}
+
+/**
+ * Provide some further statistics.
+ *
+ * @param outfile, reference to the output stream to save the statistics.
+ * @param graph, pointer to the given graph.
+ */
+void MCPresenter::printStatistics(std::ostream& outfile, AbstractGraph *graph) {
+    outfile << graph->getNumberOfComponents() << " " << graph->getNumberOfEdges();
 }
 
 /**
@@ -92,32 +95,42 @@ void MCPresenter::printStatistics(std::ofstream& outfile, AbstractGraph *graph)
  *                        1: generate line graph
  *                        2: generate random graph
  *                        3: generate empty graph
+ * @param gen, the random number generator of the graph, default is NULL == the generator of the presenter.
  *
  * @return pointer to the generated graph.
  *
  * @exception invalid whichGraph.
  * @exception invalid starting condition.
  */
-AbstractGraph *MCPresenter::generateGraph(int startCondition) {
+AbstractGraph *MCPresenter::generateGraph(int startCondition, RandomGenerator *gen) {
     AbstractGraph *graph;
+    if (gen == NULL) {
+        gen = MCPresenter::generator;
+    }
 
     // set graph type depending on whichGraph
     if (whichGraph == GENERATEER) {
         // ER graphs
         graph = new ER(parameter->connectivity,
                        numberOfVertices,
-                       MCPresenter::generator,
+                       gen,
                        parameter->isDigraph,
-                       parameter->loopsAllowed);
+                       parameter->loopsAllowed,
+                       parameter->storage,
+                       parameter->components,
+                       parameter->digraphComponents);
     } else if (whichGraph == GENERATESBM) {
         // SBM
         graph = new SBM(parameter->connectivity,
                         parameter->secondConnectivity,
                         parameter->numberOfBlocks,
                         numberOfVertices,
-                        MCPresenter::generator,
+                        gen,
                         parameter->isDigraph,
-                        parameter->loopsAllowed);
+                        parameter->loopsAllowed,
+                        parameter->storage,
+                        parameter->components,
+                        parameter->digraphComponents);
     } else {
         perror("Invalid whichGraph " + whichGraph);
         exit(EXIT_FAILURE);
@@ -145,22 +158,66 @@ AbstractGraph *MCPresenter::generateGraph(int startCondition) {
  * Initialize a new random number generator.
  *
  * @param seed, the seed for the random number generator.
+ * @param stream, the stream of the generator, default is 0 == the stream of the presenter.
  *
  * @return pointer to the random number generator.
  *
  * @exception invalid value in whichGenerator.
  */
-RandomGenerator *MCPresenter::initRandomGenerator(short unsigned int seed) {
+RandomGenerator *MCPresenter::initRandomGenerator(unsigned long long int seed, unsigned long long int stream) {
     RandomGenerator *gen;
     if (whichGenerator == DEFAULTGENERATOR) {
-        gen = new RandomGenerator(seed);
+        gen = new RandomGenerator(seed, LCG48, stream);
+    } else if (whichGenerator == XOSHIROGENERATOR) {
+        gen = new RandomGenerator(seed, XOSHIRO256, stream);
+    } else if (whichGenerator == PHILOXGENERATOR) {
+        gen = new RandomGenerator(seed, PHILOX, stream);
     } else {
-        perror("Invalid whichGenerator " + whichGenerator);
+        perror(("Invalid whichGenerator " + numToStr(whichGenerator)).c_str());
         exit(EXIT_FAILURE);
     }
     return(gen);
 }
 
+/**
+ * Initialize the observable, which provides the value of interest.
+ *
+ * @return pointer to the observable.
+ *
+ * @exception invalid value in whichValue.
+ * @exception the 2-core of a digraph.
+ * @exception more values of the number of edges than MAXIMUMNUMBEROFVALUES.
+ */
+Observable *MCPresenter::initObservable() {
+    Observable *obs;
+    if (whichValue == GETLARGESTCOMPONENTSIZE) {
+        obs = new LargestComponent(numberOfVertices);
+    } else if (whichValue == GETSECONDLARGESTCOMPONENTSIZE) {
+        obs = new SecondLargestComponent(numberOfVertices);
+    } else if (whichValue == GETNUMBEROFCOMPONENTS) {
+        obs = new NumberOfComponents(numberOfVertices);
+    } else if (whichValue == GETNUMBEROFISOLATEDVERTICES) {
+        obs = new IsolatedVertices(numberOfVertices);
+    } else if (whichValue == GETNUMBEROFEDGES) {
+        NumberOfEdges *edges = new NumberOfEdges(numberOfVertices, parameter->isDigraph, parameter->loopsAllowed);
+        if (edges->getNumberOfPairs() + 1 > MAXIMUMNUMBEROFVALUES) {
+            perror(("Too many values of the number of edges " + numToStr(edges->getNumberOfPairs() + 1)).c_str());
+            exit(EXIT_FAILURE);
+        }
+        obs = edges;
+    } else if (whichValue == GETSIZEOFTWOCORE) {
+        if (parameter->isDigraph) {
+            perror("The 2-core is only defined for undirected graphs");
+            exit(EXIT_FAILURE);
+        }
+        obs = new TwoCoreSize(numberOfVertices);
+    } else {
+        perror(("Invalid whichValue " + numToStr(whichValue)).c_str());
+        exit(EXIT_FAILURE);
+    }
+    return(obs);
+}
+
 /**
  * Generate a set of graphs and calculate a histogram.
  *
@@ -170,6 +227,41 @@ void MCPresenter::simpleSampling(int numberOfGraphs) {
     simulation->simpleSampling(numberOfGraphs);
 }
 
+/**
+ * Generate a set of graphs and calculate a histogram using the given number of threads.
+ *
+ * @param numberOfGraphs, how many graphs should be generated randomly.
+ * @param numberOfThreads, the number of threads.
+ */
+void MCPresenter::simpleSampling(int numberOfGraphs, int numberOfThreads) {
+    simulation->simpleSampling(numberOfGraphs, numberOfThreads);
+}
+
+/**
+ * Generate a set of ER graphs with the Newman-Ziff algorithm, which provides the
+ * histograms of the size of the largest component for each number of edges.
+ *
+ * @param numberOfGraphs, how many graphs should be generated randomly.
+ * @param maximumConnectivity, the maximum connectivity of interest.
+ *
+ * @exception invalid whichGraph, whichValue or components of the digraph.
+ */
+void MCPresenter::newmanZiff(int numberOfGraphs, double maximumConnectivity) {
+    if (whichGraph != GENERATEER) {
+        perror("The Newman-Ziff algorithm requires ER graphs");
+        exit(EXIT_FAILURE);
+    }
+    if (whichValue != GETLARGESTCOMPONENTSIZE) {
+        perror("The Newman-Ziff algorithm provides the largest component only");
+        exit(EXIT_FAILURE);
+    }
+    if (parameter->isDigraph && (parameter->digraphComponents != WEAKCOMPONENTS)) {
+        perror("The Newman-Ziff algorithm requires the weak components of a digraph");
+        exit(EXIT_FAILURE);
+    }
+    simulation->newmanZiff(numberOfGraphs, maximumConnectivity, parameter->isDigraph, parameter->loopsAllowed);
+}
+
 /**
  * Perform the simulation on one graph under one starting condition
  * using the Metropolis algorithm.
@@ -206,6 +298,55 @@ void MCPresenter::wangLandauAlgorithm(int lowerBound, int upperBound, int sweeps
     simulation->wangLandauAlgorithm(lowerBound, upperBound, sweepsToEvaluate, modiFacFinal);
 }
 
+/**
+ * Perform the Wang-Landau algorithm on overlapping windows of the value at once
+ * (replica-exchange Wang-Landau), each window has its own walker, density and histogram.
+ *
+ * @param lowerBounds, the minimum values of the windows in increasing order.
+ * @param upperBounds, the maximum values of the windows in increasing order.
+ * @param numberOfWindows, the number of windows.
+ * @param sweepsToEvaluate, the number of sweeps after that the
+ *        histogram check is performed.
+ * @param modiFacFinal, the final modification factor.
+ * @param sweepsToExchange, the number of sweeps between two exchanges.
+ */
+void MCPresenter::replicaExchangeWangLandau(int lowerBounds[], int upperBounds[], int numberOfWindows,
+                                            int sweepsToEvaluate, double modiFacFinal, int sweepsToExchange) {
+    simulation->replicaExchangeWangLandau(lowerBounds, upperBounds, numberOfWindows,
+                                          sweepsToEvaluate, modiFacFinal, sweepsToExchange);
+}
+
+/**
+ * Perform the Wang-Landau algorithm with multiple walkers in one window,
+ * which share the density and the histogram.
+ *
+ * @param lowerBound, the minimum value for accepting the step.
+ * @param upperBound, the maximum value for accepting the step.
+ * @param sweepsToEvaluate, the number of sweeps after that the
+ *        histogram check is performed.
+ * @param modiFacFinal, the final modification factor.
+ * @param numberOfWalkers, the number of walkers.
+ */
+void MCPresenter::multipleWalkerWangLandau(int lowerBound, int upperBound, int sweepsToEvaluate, double modiFacFinal,
+                                           int numberOfWalkers) {
+    simulation->multipleWalkerWangLandau(lowerBound, upperBound, sweepsToEvaluate, modiFacFinal, numberOfWalkers);
+}
+
+/**
+ * Perform the simulation on one graph per temperature using the Metropolis algorithm,
+ * where the graphs of neighboring temperatures are exchanged (parallel tempering).
+ *
+ * @param temperatures, the artificial temperatures, make sure temperature != 0.
+ * @param numberOfTemperatures, the number of temperatures.
+ * @param sweeps, how many sweeps should be recorded.
+ * @param equilibrationSweeps, number of sweeps to perform, until the simulation is equilibrated.
+ * @param sweepsToExchange, the number of sweeps between two exchanges.
+ */
+void MCPresenter::parallelTempering(double temperatures[], int numberOfTemperatures, int sweeps,
+                                    int equilibrationSweeps, int sweepsToExchange) {
+    simulation->parallelTempering(temperatures, numberOfTemperatures, sweeps, equilibrationSweeps, sweepsToExchange);
+}
+
 /**
  * Getter for the number of vertices.
  *
@@ -215,6 +356,42 @@ int MCPresenter::getNumberOfVertices() {
     return(numberOfVertices);
 }
 
+/**
+ * Getter for the seed of the random number generator.
+ *
+ * @return the seed.
+ */
+unsigned long long int MCPresenter::getSeed() {
+    return(generatorSeed);
+}
+
+/**
+ * Getter for the minimum value of interest.
+ *
+ * @return the minimum value of interest.
+ */
+int MCPresenter::getMinimumValue() {
+    return(observable->getMinimumValue());
+}
+
+/**
+ * Getter for the maximum value of interest.
+ *
+ * @return the maximum value of interest.
+ */
+int MCPresenter::getMaximumValue() {
+    return(observable->getMaximumValue());
+}
+
+/**
+ * Getter for the maximum difference of the value of interest caused by one step.
+ *
+ * @return the maximum difference.
+ */
+int MCPresenter::getMaximumDifference() {
+    return(observable->getMaximumDifference());
+}
+
 /**
  * Return a random number in [0, 1].
  *
@@ -223,3 +400,21 @@ int MCPresenter::getNumberOfVertices() {
 double MCPresenter::randomNumber() {
     return (generator->randomNumber());
 }
+
+/**
+ * Return a random integer in [0, RANDOMINTEGERRANGE).
+ *
+ * @return The random integer.
+ */
+long MCPresenter::randomInteger() {
+    return (generator->randomInteger());
+}
+
+/**
+ * Return a random vertex in [0, numberOfVertices).
+ *
+ * @return The random vertex.
+ */
+int MCPresenter::randomVertex() {
+    return (generator->randomVertex(numberOfVertices));
+}
@@ -28,8 +28,10 @@
 #include "graphGeneratorMakros.h"
 #include "graphParameter.h"
 #include "mcSimulation.h"
+#include "observable.h"
 #include "randomGenerator.h"
 #include "sbm.h"
+#include "strNumConv.h"
 
 class MCSimulation;
 
@@ -37,9 +39,16 @@ class MCSimulation;
  * Define some usefull makros.
  */
 #define GETLARGESTCOMPONENTSIZE 0
+#define GETSECONDLARGESTCOMPONENTSIZE 1
+#define GETNUMBEROFCOMPONENTS 2
+#define GETNUMBEROFISOLATEDVERTICES 3
+#define GETNUMBEROFEDGES 4
+#define GETSIZEOFTWOCORE 5
 #define GENERATEER 0
 #define GENERATESBM 1
 #define DEFAULTGENERATOR 0
+#define XOSHIROGENERATOR 1
+#define PHILOXGENERATOR 2
 
 /**
  * This class defines the presenter according to the MVP-pattern for
@@ -54,11 +63,11 @@ public:
      * @param d, where the file should be saved.
      * @param n, number of vertices.
      * @param seed, the seed for the random number generator.
-     * @param generatorNumber, the generator to use, default is 0 == RandomGenerator().
+     * @param generatorNumber, the generator to use, default is 0 == drand48 LCG, 1 == xoshiro256**, 2 == Philox.
      * @param graphNumber, the graph to use, default is 0 == ER random graph.
      * @param valueNumber, the value to use for the algorithm, default is 0 == largest component.
      */
-    MCPresenter(GraphParameter *p, std::string d, int n, unsigned short int seed,
+    MCPresenter(GraphParameter *p, std::string d, int n, unsigned long long int seed,
                  int generatorNumber = 0, int graphNumber = 0, int valueNumber = 0);
 
     /**
@@ -73,6 +82,25 @@ public:
      */
     void simpleSampling(int numberOfGraphs);
 
+    /**
+     * Generate a set of graphs and calculate a histogram using the given number of threads.
+     *
+     * @param numberOfGraphs, how many graphs should be generated randomly.
+     * @param numberOfThreads, the number of threads.
+     */
+    void simpleSampling(int numberOfGraphs, int numberOfThreads);
+
+    /**
+     * Generate a set of ER graphs with the Newman-Ziff algorithm, which provides the
+     * histograms of the size of the largest component for each number of edges.
+     *
+     * @param numberOfGraphs, how many graphs should be generated randomly.
+     * @param maximumConnectivity, the maximum connectivity of interest.
+     *
+     * @exception invalid whichGraph, whichValue or components of the digraph.
+     */
+    void newmanZiff(int numberOfGraphs, double maximumConnectivity);
+
     /**
      * Perform the simulation on one graph under one starting condition
      * using the Metropolis algorithm.
@@ -103,26 +131,75 @@ public:
      */
     void wangLandauAlgorithm(int lowerBound, int upperBound, int sweepsToEvaluate, double modiFacFinal);
 
+    /**
+     * Perform the Wang-Landau algorithm on overlapping windows of the value at once
+     * (replica-exchange Wang-Landau), each window has its own walker, density and histogram.
+     *
+     * @param lowerBounds, the minimum values of the windows in increasing order.
+     * @param upperBounds, the maximum values of the windows in increasing order.
+     * @param numberOfWindows, the number of windows.
+     * @param sweepsToEvaluate, the number of sweeps after that the
+     *        histogram check is performed.
+     * @param modiFacFinal, the final modification factor.
+     * @param sweepsToExchange, the number of sweeps between two exchanges.
+     */
+    void replicaExchangeWangLandau(int lowerBounds[], int upperBounds[], int numberOfWindows,
+                                   int sweepsToEvaluate, double modiFacFinal, int sweepsToExchange);
+
+    /**
+     * Perform the Wang-Landau algorithm with multiple walkers in one window,
+     * which share the density and the histogram.
+     *
+     * @param lowerBound, the minimum value for accepting the step.
+     * @param upperBound, the maximum value for accepting the step.
+     * @param sweepsToEvaluate, the number of sweeps after that the
+     *        histogram check is performed.
+     * @param modiFacFinal, the final modification factor.
+     * @param numberOfWalkers, the number of walkers.
+     */
+    void multipleWalkerWangLandau(int lowerBound, int upperBound, int sweepsToEvaluate, double modiFacFinal,
+                                  int numberOfWalkers);
+
+    /**
+     * Perform the simulation on one graph per temperature using the Metropolis algorithm,
+     * where the graphs of neighboring temperatures are exchanged (parallel tempering).
+     *
+     * @param temperatures, the artificial temperatures, make sure temperature != 0.
+     * @param numberOfTemperatures, the number of temperatures.
+     * @param sweeps, how many sweeps should be recorded.
+     * @param equilibrationSweeps, number of sweeps to perform, until the simulation is equilibrated.
+     * @param sweepsToExchange, the number of sweeps between two exchanges.
+     */
+    void parallelTempering(double temperatures[], int numberOfTemperatures, int sweeps,
+                           int equilibrationSweeps, int sweepsToExchange);
+
     /**
      * Get the value of interest from the graph.
      *
      * @param graph, pointer to the given graph.
      *
      * @return The value of interest for the given graph.
-     *
-     * @exception invalid value in whichValue.
      */
     double getValueOfInterest(AbstractGraph *graph);
 
     /**
-     * Provide some further statistics.
+     * Get the value of interest from the proposed candidate graph of the given graph.
+     * The calculation may stop, as soon as the value exceeds the given bound.
      *
-     * @param outfile, reference to the outfile-object to save the statistics.
      * @param graph, pointer to the given graph.
+     * @param bound, the maximum value, which is of interest.
      *
-     * @exception invalid value in whichValue.
+     * @return The value of interest for the candidate graph or a value bigger than the bound.
      */
-    void printStatistics(std::ofstream& outfile, AbstractGraph *graph);
+    double getCandidateValueOfInterest(AbstractGraph *graph, double bound);
+
+    /**
+     * Provide some further statistics.
+     *
+     * @param outfile, reference to the output stream to save the statistics.
+     * @param graph, pointer to the given graph.
+     */
+    void printStatistics(std::ostream& outfile, AbstractGraph *graph);
 
     /**
      * Generate a new graph.
@@ -131,24 +208,37 @@ public:
      *                        1: generate line graph
      *                        2: generate random graph
      *                        3: generate empty graph
+     * @param gen, the random number generator of the graph, default is NULL == the generator of the presenter.
      *
      * @return pointer to the generated graph.
      *
      * @exception invalid whichGraph.
      * @exception invalid starting condition.
      */
-    AbstractGraph *generateGraph(int startCondition);
+    AbstractGraph *generateGraph(int startCondition, RandomGenerator *gen = NULL);
 
     /**
      * Initialize a new random number generator.
      *
      * @param seed, the seed for the random number generator.
+     * @param stream, the stream of the generator, default is 0 == the stream of the presenter.
      *
      * @return pointer to the random number generator.
      *
      * @exception invalid value in whichGenerator.
      */
-    RandomGenerator *initRandomGenerator(short unsigned int seed);
+    RandomGenerator *initRandomGenerator(unsigned long long int seed, unsigned long long int stream = 0);
+
+    /**
+     * Initialize the observable, which provides the value of interest.
+     *
+     * @return pointer to the observable.
+     *
+     * @exception invalid value in whichValue.
+     * @exception the 2-core of a digraph.
+     * @exception more values of the number of edges than MAXIMUMNUMBEROFVALUES.
+     */
+    Observable *initObservable();
 
     /**
      * Return a random number in [0, 1].
@@ -157,6 +247,20 @@ public:
      */
      double randomNumber();
 
+    /**
+     * Return a random integer in [0, RANDOMINTEGERRANGE).
+     *
+     * @return The random integer.
+     */
+     long randomInteger();
+
+    /**
+     * Return a random vertex in [0, numberOfVertices).
+     *
+     * @return The random vertex.
+     */
+     int randomVertex();
+
      /**
       * Getter for the number of vertices.
       *
@@ -164,13 +268,43 @@ public:
       */
      int getNumberOfVertices();
 
+     /**
+      * Getter for the seed of the random number generator.
+      *
+      * @return the seed.
+      */
+     unsigned long long int getSeed();
+
+     /**
+      * Getter for the minimum value of interest.
+      *
+      * @return the minimum value of interest.
+      */
+     int getMinimumValue();
+
+     /**
+      * Getter for the maximum value of interest.
+      *
+      * @return the maximum value of interest.
+      */
+     int getMaximumValue();
+
+     /**
+      * Getter for the maximum difference of the value of interest caused by one step.
+      *
+      * @return the maximum difference.
+      */
+     int getMaximumDifference();
+
 private:
     GraphParameter *parameter;
     int whichGraph;
     int numberOfVertices;
     int whichGenerator;
     int whichValue;
+    unsigned long long int generatorSeed;
     RandomGenerator *generator;
+    Observable *observable;
     MCSimulation *simulation;
 };
 
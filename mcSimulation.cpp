@@ -20,6 +20,18 @@
 
 #include "mcSimulation.h"
 
+/**
+ * Order the temperatures by their inverse, such that neighbors are close in 1 / T.
+ *
+ * @param a, the first temperature.
+ * @param b, the second temperature.
+ *
+ * @return true: 1 / a < 1 / b, false: otherwise.
+ */
+static bool isLessInverseTemperature(double a, double b) {
+    return((1.0 / a) < (1.0 / b));
+}
+
 /**
  * Constructor for setting up the simulation.
  *
@@ -29,7 +41,7 @@
 MCSimulation::MCSimulation(std::string d, MCPresenter *presenter) {
     directory = d;
     simulationPresenter = presenter;
-    histogram = new Histogram(simulationPresenter->getNumberOfVertices());
+    histogram = new Histogram(simulationPresenter->getMinimumValue(), simulationPresenter->getMaximumValue());
 }
 
 /**
@@ -46,18 +58,10 @@ MCSimulation::~MCSimulation() {
  */
 void MCSimulation::simpleSampling(int numberOfGraphs) {
     AbstractGraph *graph = simulationPresenter->generateGraph(GENERATEEMPTYGRAPH);
-    double result;
     std::ofstream outfile;
     outfile.open((directory + "/" + "ss_" + numToStr(simulationPresenter->getNumberOfVertices()) + "_"
                                           + numToStr(numberOfGraphs) + ".dat").c_str());
-    for (int i = 0; i < numberOfGraphs; i++) {
-        graph->generateRandom(); // generate a randomly drawn graph
-        result = simulationPresenter->getValueOfInterest(graph);
-        outfile << i << " " << result << " ";
-        simulationPresenter->printStatistics(outfile, graph);
-        outfile << std::endl;
-        histogram->increment(result);
-    }
+    MCSimulation::sampleGraphs(graph, 0, numberOfGraphs, histogram, &outfile);
     outfile.close();
 
     histogram->saveHistogram(directory, "hist_ss_" + numToStr(simulationPresenter->getNumberOfVertices()) + "_"
@@ -65,6 +69,174 @@ void MCSimulation::simpleSampling(int numberOfGraphs) {
     delete graph;
 }
 
+/**
+ * Generate a set of graphs and calculate a histogram using the given number of threads.
+ * Each thread generates its share of the graphs with its own graph, random number stream,
+ * histogram and buffer for the lines of the graphs. The buffers are saved in the order
+ * of the threads and the histograms are added at the end. The streams require the
+ * xoshiro256** or the Philox generator.
+ *
+ * @param numberOfGraphs, how many graphs should be generated randomly.
+ * @param numberOfThreads, the number of threads.
+ */
+void MCSimulation::simpleSampling(int numberOfGraphs, int numberOfThreads) {
+    int i;
+    RandomGenerator **generators = new RandomGenerator*[numberOfThreads];
+    AbstractGraph **graphs = new AbstractGraph*[numberOfThreads];
+    Histogram **histograms = new Histogram*[numberOfThreads];
+    std::ostringstream *buffers = new std::ostringstream[numberOfThreads];
+    std::vector<std::thread> threads;
+    int firstGraph = 0;
+    int graphsOfThread;
+    for (i = 0; i < numberOfThreads; i++) {
+        // stream 0 is the generator of the presenter
+        generators[i] = simulationPresenter->initRandomGenerator(simulationPresenter->getSeed(), i + 1);
+        graphs[i] = simulationPresenter->generateGraph(GENERATEEMPTYGRAPH, generators[i]);
+        histograms[i] = new Histogram(simulationPresenter->getMinimumValue(), simulationPresenter->getMaximumValue());
+        // distribute the graphs as equal as possible
+        graphsOfThread = numberOfGraphs / numberOfThreads + ((i < numberOfGraphs % numberOfThreads) ? 1 : 0);
+        threads.push_back(std::thread(&MCSimulation::sampleGraphs, this, graphs[i], firstGraph, graphsOfThread,
+                                      histograms[i], &buffers[i]));
+        firstGraph += graphsOfThread;
+    }
+
+    std::ofstream outfile;
+    outfile.open((directory + "/" + "ss_" + numToStr(simulationPresenter->getNumberOfVertices()) + "_"
+                                          + numToStr(numberOfGraphs) + ".dat").c_str());
+    for (i = 0; i < numberOfThreads; i++) {
+        threads[i].join();
+        outfile << buffers[i].str();
+        histogram->addHistogram(histograms[i]);
+    }
+    outfile.close();
+
+    histogram->saveHistogram(directory, "hist_ss_" + numToStr(simulationPresenter->getNumberOfVertices()) + "_"
+                                                   + numToStr(numberOfGraphs));
+
+    // clean up
+    for (i = 0; i < numberOfThreads; i++) {
+        delete graphs[i];
+        delete histograms[i];
+        delete generators[i];
+    }
+    delete [] graphs;
+    delete [] histograms;
+    delete [] generators;
+    delete [] buffers;
+}
+
+/**
+ * Generate a set of ER graphs with the Newman-Ziff algorithm: the edges are inserted one by
+ * one in a random order, while the components are kept by a union-find structure. Hence one
+ * pass of each graph provides the size of the largest component for each number of edges
+ * M up to the cap mean + 6 sigma of the binomial distribution Binom(pairs, cMax / n), or all
+ * pairs, if this is smaller. The histograms P(S | M) can be convolved to each connectivity
+ * c <= cMax afterwards, the truncated tail has a weight below 1e-9:
+ * P_c(S) = sum_M binom(pairs, M) p^M (1 - p)^(pairs - M) P(S | M), with p = c / n.
+ *
+ * @param numberOfGraphs, how many graphs should be generated randomly.
+ * @param maximumConnectivity, the maximum connectivity of interest.
+ * @param digraph, true: the edges are ordered pairs and the components are weak, false: no digraph.
+ * @param loopsAllowed, true: loops enabled, false: loops disabled.
+ */
+void MCSimulation::newmanZiff(int numberOfGraphs, double maximumConnectivity, bool digraph, bool loopsAllowed) {
+    int numberOfVertices = simulationPresenter->getNumberOfVertices();
+    // the number of pairs, which may be an edge, and the number of edges of interest
+    long long int pairs = ((long long int) numberOfVertices) * (numberOfVertices - 1) / (digraph ? 1 : 2)
+                          + (loopsAllowed ? numberOfVertices : 0);
+    // the number of edges is binomially distributed, hence the cap is 6 standard deviations above the mean
+    double probability = std::min(1.0, maximumConnectivity / numberOfVertices);
+    double meanEdges = probability * pairs;
+    long long int maximumEdges = std::min(pairs, (long long int) ceil(meanEdges + 6.0 * sqrt(meanEdges * (1.0 - probability))));
+    // counts[M][S] is the number of graphs with M edges and the largest component S, only the
+    // few sizes near the mean occur for each M, hence a sparse map per M instead of a M x n table
+    std::map<int, unsigned int> *counts = new std::map<int, unsigned int>[maximumEdges + 1];
+    double *sum = new double[maximumEdges + 1];
+    double *sumOfSquares = new double[maximumEdges + 1];
+    long long int edges;
+    for (edges = 0; edges <= maximumEdges; edges++) {
+        sum[edges] = 0.0;
+        sumOfSquares[edges] = 0.0;
+    }
+
+    ComponentTracker *tracker = new ComponentTracker(numberOfVertices);
+    std::unordered_set<long long int> insertedEdges; // the keys of the inserted pairs
+    insertedEdges.reserve(maximumEdges);
+    int head, tail, size;
+    for (int i = 0; i < numberOfGraphs; i++) {
+        tracker->reset();
+        insertedEdges.clear();
+        for (edges = 0; edges <= maximumEdges; edges++) {
+            if (edges > 0) {
+                // draw pairs, until one is found, which is not an edge yet
+                do {
+                    head = simulationPresenter->randomVertex();
+                    tail = simulationPresenter->randomVertex();
+                    if (!digraph && (head > tail)) {
+                        std::swap(head, tail);
+                    }
+                } while (((head == tail) && !loopsAllowed)
+                         || !insertedEdges.insert(((long long int) head) * numberOfVertices + tail).second);
+                tracker->merge(head, tail);
+            }
+            size = tracker->getSizeOfLargestComponent();
+            counts[edges][size]++;
+            sum[edges] += size;
+            sumOfSquares[edges] += ((double) size) * size;
+        }
+    }
+
+    // save the mean of the largest component and the histograms for each number of edges
+    double mean, err;
+    std::ofstream outfile;
+    outfile.open((directory + "/" + "nz_" + numToStr(numberOfVertices) + "_"
+                                          + numToStr(numberOfGraphs) + ".dat").c_str());
+    for (edges = 0; edges <= maximumEdges; edges++) {
+        mean = sum[edges] / numberOfGraphs;
+        err = (numberOfGraphs > 1) ? sqrt((sumOfSquares[edges] / numberOfGraphs - mean * mean) / (numberOfGraphs - 1.0)) : 0.0;
+        outfile << edges << " " << mean << " " << err << std::endl;
+    }
+    outfile.close();
+    outfile.open((directory + "/" + "hist_nz_" + numToStr(numberOfVertices) + "_"
+                                               + numToStr(numberOfGraphs) + ".dat").c_str());
+    for (edges = 0; edges <= maximumEdges; edges++) {
+        // only non zero entries are stored
+        for (std::map<int, unsigned int>::iterator it = counts[edges].begin(); it != counts[edges].end(); ++it) {
+            outfile << edges << " " << it->first << " " << it->second << std::endl;
+        }
+    }
+    outfile.close();
+
+    // clean up
+    delete tracker;
+    delete [] counts;
+    delete [] sum;
+    delete [] sumOfSquares;
+}
+
+/**
+ * Generate the given number of random graphs, save one line per graph and add the values
+ * to the given histogram.
+ *
+ * @param graph, pointer to the graph, which is generated randomly.
+ * @param firstGraph, the number of the first graph for the outfile.
+ * @param numberOfGraphs, how many graphs should be generated randomly.
+ * @param hist, pointer to the histogram.
+ * @param outfile, the stream for the lines of the graphs.
+ */
+void MCSimulation::sampleGraphs(AbstractGraph *graph, int firstGraph, int numberOfGraphs, Histogram *hist,
+                                std::ostream *outfile) {
+    double result;
+    for (int i = firstGraph; i < firstGraph + numberOfGraphs; i++) {
+        graph->generateRandom(); // generate a randomly drawn graph
+        result = simulationPresenter->getValueOfInterest(graph);
+        *outfile << i << " " << result << " ";
+        simulationPresenter->printStatistics(*outfile, graph);
+        *outfile << std::endl;
+        hist->increment(result);
+    }
+}
+
 /**
  * Perform the simulation on one graph under one starting condition
  * using the Metropolis algorithm.
@@ -79,6 +251,7 @@ void MCSimulation::metropolisAlgorithm(double temperature, int sweeps, int equil
     parameterCollector_type parameters;
     parameters.temperature = temperature;
     int numberOfVertices = simulationPresenter->getNumberOfVertices();
+    parameters.acceptance = new AcceptanceTable(temperature, simulationPresenter->getMaximumDifference());
     AbstractGraph *graph = simulationPresenter->generateGraph(GENERATERANDOMGRAPH); // always start with an random graph
     // equilibrate system
     for (i = 0; i < numberOfVertices * equilibrationSweeps; i++) {
@@ -107,6 +280,7 @@ void MCSimulation::metropolisAlgorithm(double temperature, int sweeps, int equil
                                                    + numToStr(sweeps) + "_"
                                                    + numToStr(temperature));
 
+    delete parameters.acceptance;
     delete graph;
 }
 
@@ -121,6 +295,8 @@ void MCSimulation::calculateEquilibrationSteps(double temperature, int equilibra
     parameterCollector_type parameters;
     parameters.temperature = temperature;
     int numberOfVertices = simulationPresenter->getNumberOfVertices();
+    // the four graphs share the acceptance probabilities
+    parameters.acceptance = new AcceptanceTable(temperature, simulationPresenter->getMaximumDifference());
 
     // declare the graph variables
     AbstractGraph *completeGraph;
@@ -171,6 +347,7 @@ void MCSimulation::calculateEquilibrationSteps(double temperature, int equilibra
     delete lineGraph;
     delete randomGraph;
     delete emptyGraph;
+    delete parameters.acceptance;
 }
 
 /**
@@ -184,84 +361,572 @@ void MCSimulation::calculateEquilibrationSteps(double temperature, int equilibra
  * @param modiFacFinal, the final modification factor.
  */
 void MCSimulation::wangLandauAlgorithm(int lowerBound, int upperBound, int sweepsToEvaluate, double modiFacFinal) {
+    walker_type *walker = MCSimulation::initWalker(lowerBound, upperBound, sweepsToEvaluate, modiFacFinal, NULL, "");
+
+    // execute the algorithm
+    MCSimulation::advanceWalker(walker, sweepsToEvaluate, modiFacFinal, INT_MAX, true);
+
+    MCSimulation::finishWalker(walker, sweepsToEvaluate, modiFacFinal);
+}
+
+/**
+ * Perform the Wang-Landau algorithm on overlapping windows of the value at once
+ * (replica-exchange Wang-Landau). Each window has its own walker, density and histogram
+ * and is advanced on its own thread with its own random number stream. After each
+ * sweepsToExchange sweeps the graphs of the neighboring windows i, i + 1 are exchanged,
+ * if both values lie in the overlap, with the probability
+ * min(1, g_i(S_i) g_i+1(S_i+1) / (g_i(S_i+1) g_i+1(S_i))). A window stops, as soon as its
+ * modification factor is below the final one, the files of each window equal those of
+ * the Wang-Landau algorithm. The streams require the xoshiro256** or the Philox generator.
+ *
+ * @param lowerBounds, the minimum values of the windows in increasing order.
+ * @param upperBounds, the maximum values of the windows in increasing order.
+ * @param numberOfWindows, the number of windows.
+ * @param sweepsToEvaluate, the number of sweeps after that the
+ *        histogram check is performed.
+ * @param modiFacFinal, the final modification factor.
+ * @param sweepsToExchange, the number of sweeps between two exchanges.
+ */
+void MCSimulation::replicaExchangeWangLandau(int lowerBounds[], int upperBounds[], int numberOfWindows,
+                                             int sweepsToEvaluate, double modiFacFinal, int sweepsToExchange) {
+    int i;
+    walker_type **walkers = new walker_type*[numberOfWindows];
+    RandomGenerator **generators = new RandomGenerator*[numberOfWindows];
+    unsigned long long int *attempts = new unsigned long long int[numberOfWindows];
+    unsigned long long int *accepted = new unsigned long long int[numberOfWindows];
+    for (i = 0; i < numberOfWindows; i++) {
+        // stream 0 is the generator of the presenter, which decides the exchanges
+        generators[i] = simulationPresenter->initRandomGenerator(simulationPresenter->getSeed(), i + 1);
+        walkers[i] = MCSimulation::initWalker(lowerBounds[i], upperBounds[i], sweepsToEvaluate, modiFacFinal, generators[i], "");
+        attempts[i] = 0;
+        accepted[i] = 0;
+    }
+
+    // advance the windows, until all modification factors are below the final one
+    int offset = 0;
+    bool finished = false;
+    while (!finished) {
+        MCSimulation::advanceWalkers(walkers, numberOfWindows, sweepsToEvaluate, modiFacFinal, sweepsToExchange, true);
+        MCSimulation::exchangeWalkers(walkers, numberOfWindows, offset, modiFacFinal, attempts, accepted);
+        offset = 1 - offset;
+        finished = true;
+        for (i = 0; i < numberOfWindows; i++) {
+            finished = finished && (walkers[i]->modiFac < modiFacFinal);
+        }
+    }
+
+    // save the results and the acceptance rates of the exchanges
+    std::ofstream outfile;
+    outfile.open((directory + "/" + "rewl_exchange_" + numToStr(simulationPresenter->getNumberOfVertices()) + "_"
+                                                     + numToStr(sweepsToEvaluate) + "_"
+                                                     + numToStr(modiFacFinal) + ".dat").c_str());
+    for (i = 0; i < numberOfWindows; i++) {
+        if (i + 1 < numberOfWindows) {
+            outfile << walkers[i]->lowerBound << " " << walkers[i]->upperBound << " "
+                    << walkers[i + 1]->lowerBound << " " << walkers[i + 1]->upperBound << " "
+                    << ((attempts[i] > 0) ? ((double) accepted[i]) / ((double) attempts[i]) : 0.0) << std::endl;
+        }
+        MCSimulation::finishWalker(walkers[i], sweepsToEvaluate, modiFacFinal);
+        delete generators[i];
+    }
+    outfile.close();
+
+    // clean up
+    delete [] walkers;
+    delete [] generators;
+    delete [] attempts;
+    delete [] accepted;
+}
+
+/**
+ * Perform the Wang-Landau algorithm with multiple walkers in one window, which share the
+ * density and the histogram. Each walker is advanced on its own thread with its own graph
+ * and random number stream and adds to its own copy of the density. After each
+ * sweepsToEvaluate sweeps the differences of the copies are added to the shared density,
+ * the histograms of the walkers are added to the shared histogram and the modification
+ * factor is updated using the shared histogram, where the time t counts the sweeps of all
+ * walkers. The streams require the xoshiro256** or the Philox generator.
+ *
+ * @param lowerBound, the minimum value for accepting the step.
+ * @param upperBound, the maximum value for accepting the step.
+ * @param sweepsToEvaluate, the number of sweeps after that the
+ *        histogram check is performed.
+ * @param modiFacFinal, the final modification factor.
+ * @param numberOfWalkers, the number of walkers (and threads).
+ */
+void MCSimulation::multipleWalkerWangLandau(int lowerBound, int upperBound, int sweepsToEvaluate, double modiFacFinal,
+                                            int numberOfWalkers) {
+    int i, j;
     int numberOfVertices = simulationPresenter->getNumberOfVertices();
-    double density[numberOfVertices];
-    for (int i = 0; i < numberOfVertices; i++) {
-        density[i] = log(1.0);
+    int sizeOfDensity = simulationPresenter->getMaximumValue() - simulationPresenter->getMinimumValue() + 1;
+    walker_type **walkers = new walker_type*[numberOfWalkers];
+    RandomGenerator **generators = new RandomGenerator*[numberOfWalkers];
+    for (i = 0; i < numberOfWalkers; i++) {
+        generators[i] = simulationPresenter->initRandomGenerator(simulationPresenter->getSeed(), i + 1);
+        walkers[i] = MCSimulation::initWalker(lowerBound, upperBound, sweepsToEvaluate, modiFacFinal,
+                                              generators[i], "_" + numToStr(i));
     }
-    // set the parameters:
-    parameterCollector_type parameters;
-    parameters.density = density;       // pointer to density array
-    parameters.lowerBound = lowerBound; // lower bound of the interval
-    parameters.upperBound = upperBound; // upper bound of the interval
+    // the shared density and histogram
+    double *density = new double[sizeOfDensity];
+    for (j = 0; j < sizeOfDensity; j++) {
+        density[j] = log(1.0);
+    }
+    Histogram *sharedHistogram = new Histogram(simulationPresenter->getMinimumValue(), simulationPresenter->getMaximumValue());
 
     double modiFac = log(exp(1.0)); // the modification factor
-    double value = 0.0;
-    AbstractGraph *graph = simulationPresenter->generateGraph(GENERATEEMPTYGRAPH); // always start with an empty graph
-    // insert randomly new edges, until the size of the largest component is bigger than the lower bound
-    while (!(lowerBound < simulationPresenter->getValueOfInterest(graph))) {
-        graph->generateRandomEdge();
+    bool saturated = false; // true, if the modification factor once dropped under t^-1
+    double time = 0.0; // the sweeps of all walkers
+    double difference;
+    while (modiFac >= modiFacFinal) {
+        MCSimulation::advanceWalkers(walkers, numberOfWalkers, sweepsToEvaluate, modiFacFinal, sweepsToEvaluate, false);
+        // add the differences of the copies to the shared density and copy it back
+        for (j = 0; j < sizeOfDensity; j++) {
+            difference = 0.0;
+            for (i = 0; i < numberOfWalkers; i++) {
+                difference += walkers[i]->density[j] - density[j];
+            }
+            density[j] += difference;
+            for (i = 0; i < numberOfWalkers; i++) {
+                walkers[i]->density[j] = density[j];
+            }
+        }
+        for (i = 0; i < numberOfWalkers; i++) {
+            sharedHistogram->addHistogram(walkers[i]->histogram);
+            walkers[i]->histogram->resetHistogram();
+        }
+        time += (double) (numberOfWalkers * sweepsToEvaluate);
+
+        // update the modification factor like the Wang-Landau algorithm using the shared histogram
+        if (not(modiFac <= (1.0 / time)) && not(saturated) &&
+            (sharedHistogram->areAllBinsNonZero(lowerBound, upperBound))) {
+            modiFac = modiFac / 2.0;
+            if (modiFac >= modiFacFinal) {
+                sharedHistogram->resetHistogram();
+            }
+        } else if (saturated || (modiFac <= (1.0 / time))) {
+            saturated = true;
+            modiFac = (1.0 / time);
+        }
+        for (i = 0; i < numberOfWalkers; i++) {
+            walkers[i]->modiFac = modiFac;
+        }
     }
 
-    int evalTime = (numberOfVertices * sweepsToEvaluate); // the number of steps after the histogram should be evaluated
-    bool saturated = false; // true, if the modification factor once dropped under t^-1
+    // save the shared results, the files equal those of the Wang-Landau algorithm
+    sharedHistogram->saveHistogram(directory, "hist_wl_" + numToStr(numberOfVertices) + "_"
+                                                         + numToStr(lowerBound) + "_"
+                                                         + numToStr(upperBound));
+    MCSimulation::saveDensity(density, directory, numberOfVertices, simulationPresenter->getMinimumValue(),
+                              lowerBound, upperBound, (unsigned long long int) (time * numberOfVertices));
+
+    // clean up
+    for (i = 0; i < numberOfWalkers; i++) {
+        MCSimulation::deleteWalker(walkers[i]);
+        delete generators[i];
+    }
+    delete [] walkers;
+    delete [] generators;
+    delete [] density;
+    delete sharedHistogram;
+}
+
+/**
+ * Set up a Wang-Landau walker in the given window: allocate the density and the histogram,
+ * generate a graph with a value in the window and open the outfile.
+ *
+ * @param lowerBound, the minimum value for accepting the step.
+ * @param upperBound, the maximum value for accepting the step.
+ * @param sweepsToEvaluate, the number of sweeps after that the
+ *        histogram check is performed.
+ * @param modiFacFinal, the final modification factor.
+ * @param gen, the random number generator of the graph, NULL == the generator of the presenter.
+ * @param suffix, the suffix of the name of the outfile.
+ *
+ * @return pointer to the walker.
+ */
+walker_type *MCSimulation::initWalker(int lowerBound, int upperBound, int sweepsToEvaluate, double modiFacFinal,
+                                      RandomGenerator *gen, std::string suffix) {
+    walker_type *walker = new walker_type;
+    int minimumValue = simulationPresenter->getMinimumValue();
+    int sizeOfDensity = simulationPresenter->getMaximumValue() - minimumValue + 1;
+    walker->density = new double[sizeOfDensity];
+    for (int i = 0; i < sizeOfDensity; i++) {
+        walker->density[i] = log(1.0);
+    }
+    walker->histogram = new Histogram(minimumValue, simulationPresenter->getMaximumValue());
+    walker->lowerBound = lowerBound;
+    walker->upperBound = upperBound;
+    walker->modiFac = log(exp(1.0)); // the modification factor
+    walker->saturated = false; // true, if the modification factor once dropped under t^-1
+    walker->step = 0;
+
+    AbstractGraph *graph = simulationPresenter->generateGraph(GENERATEEMPTYGRAPH, gen); // always start with an empty graph
+    if (lowerBound < simulationPresenter->getValueOfInterest(graph)) {
+        // the value decreases with the edges, insert randomly new edges, until it is not bigger than the upper bound
+        while (upperBound < simulationPresenter->getValueOfInterest(graph)) {
+            graph->generateRandomEdge();
+        }
+    } else {
+        // insert randomly new edges, until the value is bigger than the lower bound
+        while (!(lowerBound < simulationPresenter->getValueOfInterest(graph))) {
+            graph->generateRandomEdge();
+        }
+    }
+    walker->graph = graph;
+
+    walker->outfile = new std::ofstream();
+    walker->outfile->open((directory + "/" + "wl_" + numToStr(simulationPresenter->getNumberOfVertices()) + "_"
+                                                   + numToStr(lowerBound) + "_" + numToStr(upperBound) + "_"
+                                                   + numToStr(sweepsToEvaluate) + "_" + numToStr(modiFacFinal) + suffix + ".dat").c_str());
+    return(walker);
+}
+
+/**
+ * Perform the Wang-Landau algorithm with the given walker for the given number of sweeps
+ * or until the modification factor is below the final one.
+ *
+ * @param walker, pointer to the walker.
+ * @param sweepsToEvaluate, the number of sweeps after that the
+ *        histogram check is performed.
+ * @param modiFacFinal, the final modification factor.
+ * @param sweeps, the maximum number of sweeps to perform.
+ * @param schedule, true: update the modification factor using the histogram of the walker,
+ *                  false: the modification factor is updated by the caller.
+ */
+void MCSimulation::advanceWalker(walker_type *walker, int sweepsToEvaluate, double modiFacFinal, int sweeps, bool schedule) {
+    int numberOfVertices = simulationPresenter->getNumberOfVertices();
+    int minimumValue = simulationPresenter->getMinimumValue();
+    // set the parameters:
+    parameterCollector_type parameters;
+    parameters.density = walker->density;    // pointer to density array
+    parameters.minimumValue = minimumValue;  // value of the first density entry
+    parameters.lowerBound = walker->lowerBound; // lower bound of the interval
+    parameters.upperBound = walker->upperBound; // upper bound of the interval
+    parameters.acceptance = NULL;            // the densities change, hence there is no table
+
+    double value = 0.0;
+    unsigned long long int evalTime = (numberOfVertices * sweepsToEvaluate); // the number of steps after the histogram should be evaluated
     // some boolean parameters to make the semantics of the code clearer
     // one could write them into the if () conditions
     bool isEvalSweep = false;
     bool isSweep = false;
     bool modiFacLessTime = false;
 
-    std::ofstream outfile;
-    outfile.open((directory + "/" + "wl_" + numToStr(simulationPresenter->getNumberOfVertices()) + "_"
-                                          + numToStr(lowerBound) + "_" + numToStr(upperBound) + "_"
-                                          + numToStr(sweepsToEvaluate) + "_" + numToStr(modiFacFinal) + ".dat").c_str());
-
-    unsigned long long int step = 0;
-    // execute the algorithm
-    while (modiFac >= modiFacFinal) {
-        step += 1;
+    unsigned long long int lastStep = walker->step + ((unsigned long long int) numberOfVertices) * sweeps;
+    while ((walker->modiFac >= modiFacFinal) && (walker->step < lastStep)) {
+        walker->step += 1;
         // calculate next state
-        MCSimulation::generateNextState(USEWANGLANDAUALGORITHM, graph, parameters);
+        MCSimulation::generateNextState(USEWANGLANDAUALGORITHM, walker->graph, parameters);
         // update densities and histogram
-        value = simulationPresenter->getValueOfInterest(graph);
-        density[((int) value - 1)] = density[((int) value - 1)] + (modiFac);
-        histogram->increment(value);
-        if (step % (100 * numberOfVertices) == 0) {
-            outfile << (step + 1) / numberOfVertices << " " << value << " ";
-            simulationPresenter->printStatistics(outfile, graph);
-            outfile << std::endl;
+        value = simulationPresenter->getValueOfInterest(walker->graph);
+        walker->density[((int) value - minimumValue)] = walker->density[((int) value - minimumValue)] + (walker->modiFac);
+        walker->histogram->increment(value);
+        if (walker->step % (100 * numberOfVertices) == 0) {
+            *(walker->outfile) << (walker->step + 1) / numberOfVertices << " " << value << " ";
+            simulationPresenter->printStatistics(*(walker->outfile), walker->graph);
+            *(walker->outfile) << std::endl;
+        }
+        if (!schedule) {
+            continue; // the modification factor is updated by the caller
         }
 
         // test, whether the histogram must be reseted
         // prepare boolean parameters
-        isEvalSweep = (step % evalTime == 0); // correct step?
-        isSweep = (step % numberOfVertices == 0);
+        isEvalSweep = (walker->step % evalTime == 0); // correct step?
+        isSweep = (walker->step % numberOfVertices == 0);
         // is the modification factor less than or equals t^-1?
-        modiFacLessTime = (modiFac <= (1.0 / ((double) step / (double) numberOfVertices)));
+        modiFacLessTime = (walker->modiFac <= (1.0 / ((double) walker->step / (double) numberOfVertices)));
         if (isEvalSweep &&
-            not(modiFacLessTime) && not(saturated) && // modification factor bigger than t^-1?
-            (histogram->areAllBinsNonZero(lowerBound, upperBound))) { // is the all bins non zero condition fullfilled?
+            not(modiFacLessTime) && not(walker->saturated) && // modification factor bigger than t^-1?
+            (walker->histogram->areAllBinsNonZero(walker->lowerBound, walker->upperBound))) { // is the all bins non zero condition fullfilled?
             // reduce the modification factor
-            modiFac = modiFac / 2.0;
-            if (modiFac >= modiFacFinal) {
-                histogram->resetHistogram();
+            walker->modiFac = walker->modiFac / 2.0;
+            if (walker->modiFac >= modiFacFinal) {
+                walker->histogram->resetHistogram();
             }
-        } else if (isSweep && (saturated || modiFacLessTime)) {
+        } else if (isSweep && (walker->saturated || modiFacLessTime)) {
             // check each MC sweep, whether the modification factor must be set to t^-1
-            saturated = true;
-            modiFac = (1.0 / ((double) step / (double) numberOfVertices));
+            walker->saturated = true;
+            walker->modiFac = (1.0 / ((double) walker->step / (double) numberOfVertices));
         }
     }
+}
 
-    histogram->saveHistogram(directory, "hist_wl_" + numToStr(numberOfVertices) + "_"
-                                                   + numToStr(lowerBound) + "_"
-                                                   + numToStr(upperBound));
-    MCSimulation::saveDensity(density, directory, numberOfVertices, lowerBound, upperBound, step);
+/**
+ * Advance all walkers, whose modification factor is not below the final one,
+ * by the given number of sweeps, each walker on its own thread.
+ *
+ * @param walkers, the walkers of the windows.
+ * @param numberOfWindows, the number of windows.
+ * @param sweepsToEvaluate, the number of sweeps after that the
+ *        histogram check is performed.
+ * @param modiFacFinal, the final modification factor.
+ * @param sweeps, the maximum number of sweeps to perform.
+ * @param schedule, true: update the modification factor using the histogram of the walker,
+ *                  false: the modification factor is updated by the caller.
+ */
+void MCSimulation::advanceWalkers(walker_type *walkers[], int numberOfWindows, int sweepsToEvaluate,
+                                  double modiFacFinal, int sweeps, bool schedule) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numberOfWindows; i++) {
+        if (walkers[i]->modiFac >= modiFacFinal) {
+            threads.push_back(std::thread(&MCSimulation::advanceWalker, this, walkers[i], sweepsToEvaluate, modiFacFinal, sweeps, schedule));
+        }
+    }
+    for (unsigned int i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+}
+
+/**
+ * Exchange the graphs of the neighboring windows i, i + 1 with the replica-exchange
+ * Wang-Landau probability, where i = offset, offset + 2, ... Both windows must not be
+ * finished and both values must lie in the overlap of the windows.
+ *
+ * @param walkers, the walkers of the windows.
+ * @param numberOfWindows, the number of windows.
+ * @param offset, 0: exchange the even pairs, 1: exchange the odd pairs.
+ * @param modiFacFinal, the final modification factor.
+ * @param attempts, the number of attempted exchanges of each pair.
+ * @param accepted, the number of accepted exchanges of each pair.
+ */
+void MCSimulation::exchangeWalkers(walker_type *walkers[], int numberOfWindows, int offset, double modiFacFinal,
+                                   unsigned long long int attempts[], unsigned long long int accepted[]) {
+    int minimumValue = simulationPresenter->getMinimumValue();
+    int value;
+    int nextValue;
+    double exponent;
+    AbstractGraph *graph;
+    for (int i = offset; i + 1 < numberOfWindows; i += 2) {
+        if ((walkers[i]->modiFac < modiFacFinal) || (walkers[i + 1]->modiFac < modiFacFinal)) {
+            continue;
+        }
+        value = (int) simulationPresenter->getValueOfInterest(walkers[i]->graph);
+        nextValue = (int) simulationPresenter->getValueOfInterest(walkers[i + 1]->graph);
+        attempts[i]++;
+        if ((value < walkers[i + 1]->lowerBound) || (value > walkers[i + 1]->upperBound)
+            || (nextValue < walkers[i]->lowerBound) || (nextValue > walkers[i]->upperBound)) {
+            continue; // at least one value is not in the overlap
+        }
+        value -= minimumValue;
+        nextValue -= minimumValue;
+        exponent = walkers[i]->density[value] - walkers[i]->density[nextValue]
+                   + walkers[i + 1]->density[nextValue] - walkers[i + 1]->density[value];
+        if ((exponent >= 0.0) || (simulationPresenter->randomNumber() < exp(exponent))) {
+            graph = walkers[i]->graph;
+            walkers[i]->graph = walkers[i + 1]->graph;
+            walkers[i + 1]->graph = graph;
+            accepted[i]++;
+        }
+    }
+}
+
+/**
+ * Save the histogram and the density of the given walker and free it.
+ *
+ * @param walker, pointer to the walker.
+ * @param sweepsToEvaluate, the number of sweeps after that the
+ *        histogram check was performed.
+ * @param modiFacFinal, the final modification factor.
+ */
+void MCSimulation::finishWalker(walker_type *walker, int sweepsToEvaluate, double modiFacFinal) {
+    int numberOfVertices = simulationPresenter->getNumberOfVertices();
+    walker->histogram->saveHistogram(directory, "hist_wl_" + numToStr(numberOfVertices) + "_"
+                                                           + numToStr(walker->lowerBound) + "_"
+                                                           + numToStr(walker->upperBound));
+    MCSimulation::saveDensity(walker->density, directory, numberOfVertices, simulationPresenter->getMinimumValue(),
+                              walker->lowerBound, walker->upperBound, walker->step);
+
+    MCSimulation::deleteWalker(walker);
+}
+
+/**
+ * Free the given walker without saving its results.
+ *
+ * @param walker, pointer to the walker.
+ */
+void MCSimulation::deleteWalker(walker_type *walker) {
+    walker->outfile->close();
+    delete walker->outfile;
+    delete walker->histogram;
+    delete [] walker->density;
+    delete walker->graph;
+    delete walker;
+}
 
+/**
+ * Perform the simulation on one graph per temperature using the Metropolis algorithm,
+ * where the graphs of neighboring temperatures are exchanged (parallel tempering).
+ * Each replica is advanced on its own thread with its own random number stream,
+ * after each sweepsToExchange sweeps the graphs of the neighbors i, i + 1 are exchanged
+ * with the probability min(1, exp((1 / T_i - 1 / T_i+1) * (S_i - S_i+1))).
+ * The streams require the xoshiro256** or the Philox generator.
+ *
+ * @param temperatures, the artificial temperatures, make sure temperature != 0.
+ * @param numberOfTemperatures, the number of temperatures.
+ * @param sweeps, how many sweeps should be recorded.
+ * @param equilibrationSweeps, number of sweeps to perform, until the simulation is equilibrated.
+ * @param sweepsToExchange, the number of sweeps between two exchanges.
+ */
+void MCSimulation::parallelTempering(double temperatures[], int numberOfTemperatures, int sweeps,
+                                     int equilibrationSweeps, int sweepsToExchange) {
+    int i;
+    int numberOfVertices = simulationPresenter->getNumberOfVertices();
+    // order the temperatures by their inverse, the neighbors are exchanged
+    double *orderedTemperatures = new double[numberOfTemperatures];
+    for (i = 0; i < numberOfTemperatures; i++) {
+        orderedTemperatures[i] = temperatures[i];
+    }
+    std::sort(orderedTemperatures, orderedTemperatures + numberOfTemperatures, isLessInverseTemperature);
+
+    // set up the replicas, stream 0 is the generator of the presenter, which decides the exchanges
+    replica_type *replicas = new replica_type[numberOfTemperatures];
+    RandomGenerator **generators = new RandomGenerator*[numberOfTemperatures];
+    unsigned long long int *attempts = new unsigned long long int[numberOfTemperatures];
+    unsigned long long int *accepted = new unsigned long long int[numberOfTemperatures];
+    for (i = 0; i < numberOfTemperatures; i++) {
+        generators[i] = simulationPresenter->initRandomGenerator(simulationPresenter->getSeed(), i + 1);
+        replicas[i].temperature = orderedTemperatures[i];
+        replicas[i].graph = simulationPresenter->generateGraph(GENERATERANDOMGRAPH, generators[i]); // always start with an random graph
+        replicas[i].acceptance = new AcceptanceTable(orderedTemperatures[i], simulationPresenter->getMaximumDifference());
+        replicas[i].histogram = new Histogram(simulationPresenter->getMinimumValue(), simulationPresenter->getMaximumValue());
+        replicas[i].outfile = new std::ofstream();
+        replicas[i].outfile->open((directory + "/" + "pt_" + numToStr(numberOfVertices) + "_"
+                                                           + numToStr(sweeps) + "_"
+                                                           + numToStr(orderedTemperatures[i]) + ".dat").c_str());
+        attempts[i] = 0;
+        accepted[i] = 0;
+    }
+
+    // equilibrate system, the exchanges alternate between the even and the odd pairs
+    int offset = 0;
+    int sweep = 0;
+    int sweepsToDo;
+    while (sweep < equilibrationSweeps) {
+        sweepsToDo = std::min(sweepsToExchange, equilibrationSweeps - sweep);
+        MCSimulation::advanceReplicas(replicas, numberOfTemperatures, sweepsToDo, sweep, false);
+        MCSimulation::exchangeReplicas(replicas, numberOfTemperatures, offset, attempts, accepted);
+        offset = 1 - offset;
+        sweep += sweepsToDo;
+    }
+    for (i = 0; i < numberOfTemperatures; i++) {
+        attempts[i] = 0;
+        accepted[i] = 0;
+    }
+    // do the simulation
+    sweep = 0;
+    while (sweep < sweeps) {
+        sweepsToDo = std::min(sweepsToExchange, sweeps - sweep);
+        MCSimulation::advanceReplicas(replicas, numberOfTemperatures, sweepsToDo, sweep, true);
+        MCSimulation::exchangeReplicas(replicas, numberOfTemperatures, offset, attempts, accepted);
+        offset = 1 - offset;
+        sweep += sweepsToDo;
+    }
+
+    // save the histograms and the acceptance rates of the exchanges
+    std::ofstream outfile;
+    outfile.open((directory + "/" + "pt_exchange_" + numToStr(numberOfVertices) + "_"
+                                                   + numToStr(sweeps) + ".dat").c_str());
+    for (i = 0; i < numberOfTemperatures; i++) {
+        replicas[i].outfile->close();
+        replicas[i].histogram->saveHistogram(directory, "hist_pt_" + numToStr(numberOfVertices) + "_"
+                                                                   + numToStr(sweeps) + "_"
+                                                                   + numToStr(replicas[i].temperature));
+        if (i + 1 < numberOfTemperatures) {
+            outfile << replicas[i].temperature << " " << replicas[i + 1].temperature << " "
+                    << ((attempts[i] > 0) ? ((double) accepted[i]) / ((double) attempts[i]) : 0.0) << std::endl;
+        }
+    }
     outfile.close();
 
     // clean up
-    delete graph;
+    for (i = 0; i < numberOfTemperatures; i++) {
+        delete replicas[i].graph;
+        delete replicas[i].acceptance;
+        delete replicas[i].histogram;
+        delete replicas[i].outfile;
+        delete generators[i];
+    }
+    delete [] replicas;
+    delete [] generators;
+    delete [] attempts;
+    delete [] accepted;
+    delete [] orderedTemperatures;
+}
+
+/**
+ * Advance all replicas by the given number of sweeps, each replica on its own thread.
+ *
+ * @param replicas, the replicas ordered by the inverse temperature.
+ * @param numberOfTemperatures, the number of replicas.
+ * @param sweeps, the number of sweeps to perform.
+ * @param firstSweep, the number of the first sweep for the outfiles.
+ * @param record, true: record each sweep, false: equilibrate.
+ */
+void MCSimulation::advanceReplicas(replica_type replicas[], int numberOfTemperatures, int sweeps, int firstSweep, bool record) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numberOfTemperatures; i++) {
+        threads.push_back(std::thread(&MCSimulation::advanceReplica, this, &replicas[i], sweeps, firstSweep, record));
+    }
+    for (int i = 0; i < numberOfTemperatures; i++) {
+        threads[i].join();
+    }
+}
+
+/**
+ * Advance one replica by the given number of sweeps using the Metropolis algorithm.
+ *
+ * @param replica, pointer to the replica.
+ * @param sweeps, the number of sweeps to perform.
+ * @param firstSweep, the number of the first sweep for the outfile.
+ * @param record, true: record each sweep, false: equilibrate.
+ */
+void MCSimulation::advanceReplica(replica_type *replica, int sweeps, int firstSweep, bool record) {
+    double result;
+    int numberOfVertices = simulationPresenter->getNumberOfVertices();
+    parameterCollector_type parameters;
+    parameters.temperature = replica->temperature;
+    parameters.acceptance = replica->acceptance;
+    for (int sweep = 0; sweep < sweeps; sweep++) {
+        for (int i = 0; i < numberOfVertices; i++) {
+            MCSimulation::generateNextState(USEMETROPOLISALGORITHM, replica->graph, parameters);
+        }
+        if (record) {
+            result = simulationPresenter->getValueOfInterest(replica->graph);
+            *(replica->outfile) << (firstSweep + sweep + 1) << " " << result << " ";
+            simulationPresenter->printStatistics(*(replica->outfile), replica->graph);
+            *(replica->outfile) << std::endl;
+            replica->histogram->increment(result);
+        }
+    }
+}
+
+/**
+ * Exchange the graphs of the neighboring replicas i, i + 1 with the parallel tempering
+ * probability, where i = offset, offset + 2, ...
+ *
+ * @param replicas, the replicas ordered by the inverse temperature.
+ * @param numberOfTemperatures, the number of replicas.
+ * @param offset, 0: exchange the even pairs, 1: exchange the odd pairs.
+ * @param attempts, the number of attempted exchanges of each pair.
+ * @param accepted, the number of accepted exchanges of each pair.
+ */
+void MCSimulation::exchangeReplicas(replica_type replicas[], int numberOfTemperatures, int offset,
+                                    unsigned long long int attempts[], unsigned long long int accepted[]) {
+    double exponent;
+    AbstractGraph *graph;
+    for (int i = offset; i + 1 < numberOfTemperatures; i += 2) {
+        exponent = ((1.0 / replicas[i].temperature) - (1.0 / replicas[i + 1].temperature))
+                   * (simulationPresenter->getValueOfInterest(replicas[i].graph)
+                      - simulationPresenter->getValueOfInterest(replicas[i + 1].graph));
+        attempts[i]++;
+        if ((exponent >= 0.0) || (simulationPresenter->randomNumber() < exp(exponent))) {
+            graph = replicas[i].graph;
+            replicas[i].graph = replicas[i + 1].graph;
+            replicas[i + 1].graph = graph;
+            accepted[i]++;
+        }
+    }
 }
 
 /**
@@ -276,17 +941,19 @@ void MCSimulation::generateNextState(int algorithm, AbstractGraph *currentState,
                                       parameterCollector_type parameters) {
     // 1. save size of the largest component of the current state
     double currentValue = simulationPresenter->getValueOfInterest(currentState);
-    // 2. generate the candidate graph
-    int *vertex;
-    vertex = new int;
-    previousState safedState = currentState->generateCandidateGraph(vertex);
-    // 3. accept the candidate graph with the metropolis probability
-    if (!MCSimulation::acceptNewState(algorithm, currentValue, simulationPresenter->getValueOfInterest(currentState), parameters)) {
-        currentState->revertGenerateCandidateGraph(*vertex, safedState); // reject candidate
+    // 2. propose the candidate graph, the graph is not changed yet
+    currentState->proposeCandidateGraph();
+    // 3. draw the random integer first, it bounds the value of an acceptable candidate graph,
+    //    the generator of the graph is used, such that each replica draws from its own stream
+    long randomInteger = currentState->getRandomGenerator()->randomInteger();
+    double bound = MCSimulation::maximumAcceptedValue(algorithm, currentValue, randomInteger, parameters);
+    double candidateValue = simulationPresenter->getCandidateValueOfInterest(currentState, bound);
+    // 4. accept the candidate graph with the metropolis probability
+    if (MCSimulation::acceptNewState(algorithm, currentValue, candidateValue, randomInteger, parameters)) {
+        currentState->acceptCandidateGraph();
+    } else {
+        currentState->rejectCandidateGraph(); // reject candidate
     }
-
-    // clean up
-    delete vertex;
 }
 
 /**
@@ -295,6 +962,7 @@ void MCSimulation::generateNextState(int algorithm, AbstractGraph *currentState,
  * @param algorithm, the used algorithm for importance sampling.
  * @param currentValue, value for the current state.
  * @param candidateValue, value for the candidate graph.
+ * @param randomInteger, the random integer drawn for this decision.
  * @param parameters, the required parameters for the accept / reject decision.
  *
  * @return true: accept the candidate graph, false: reject the candidate graph.
@@ -302,21 +970,50 @@ void MCSimulation::generateNextState(int algorithm, AbstractGraph *currentState,
  * @exception Invalid algorithm number.
  */
 bool MCSimulation::acceptNewState(int algorithm, double currentValue, double candidateValue,
-                                   parameterCollector_type parameters) {
+                                   long randomInteger, parameterCollector_type parameters) {
     if (algorithm == USEMETROPOLISALGORITHM) {
-        // use the Metropolis algorithm
-        double exponent = (candidateValue - currentValue) / parameters.temperature;
-        double metropolisProbability = std::min(1.0, exp(-exponent));
-        return (simulationPresenter->randomNumber() <= metropolisProbability);
+        // use the Metropolis algorithm, the values are integers
+        return (parameters.acceptance->accept((int) (candidateValue - currentValue), randomInteger));
     } else if (algorithm == USEWANGLANDAUALGORITHM) {
         // use the Wang-Landau algorithm
-        double exponent = ((*(parameters.density + ((int) currentValue - 1))) / (*(parameters.density + ((int) candidateValue - 1))));
+        double randomNumber = ((double) randomInteger) / ((double) RANDOMINTEGERRANGE);
+        // the densities are logarithms, the ratio g(current) / g(candidate) is the exponential of the difference
+        double exponent = ((*(parameters.density + ((int) currentValue - parameters.minimumValue)))
+                           - (*(parameters.density + ((int) candidateValue - parameters.minimumValue))));
         double aP = std::min(1.0, exp(exponent)); // acceptance probability
-        return ((simulationPresenter->randomNumber() <= aP)
+        return ((randomNumber <= aP)
                  && (candidateValue >= parameters.lowerBound)
                  && (candidateValue <= parameters.upperBound));
     } else {
-        perror("Invalid algorithm " + algorithm);
+        perror(("Invalid algorithm " + numToStr(algorithm)).c_str());
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Calculate the maximum value of a candidate graph, which may be accepted
+ * with the given random integer. Each bigger value is rejected by acceptNewState.
+ * Only this upper bound stops the calculation of the candidate value early: the lower
+ * limits, i.e. the rejection of smaller values for T < 0 and at the lower bound of the
+ * Wang-Landau window, are left to acceptNewState.
+ *
+ * @param algorithm, the used algorithm for importance sampling.
+ * @param currentValue, value for the current state.
+ * @param randomInteger, the random integer drawn for this decision.
+ * @param parameters, the required parameters for the accept / reject decision.
+ *
+ * @return the maximum value, which may be accepted.
+ *
+ * @exception Invalid algorithm number.
+ */
+double MCSimulation::maximumAcceptedValue(int algorithm, double currentValue, long randomInteger,
+                                          parameterCollector_type parameters) {
+    if (algorithm == USEMETROPOLISALGORITHM) {
+        return(currentValue + parameters.acceptance->maximumAcceptedDifference(randomInteger));
+    } else if (algorithm == USEWANGLANDAUALGORITHM) {
+        return(parameters.upperBound);
+    } else {
+        perror(("Invalid algorithm " + numToStr(algorithm)).c_str());
         exit(EXIT_FAILURE);
     }
 }
@@ -327,12 +1024,13 @@ bool MCSimulation::acceptNewState(int algorithm, double currentValue, double can
  * @param density, which must be saved.
  * @param directory where the result should be saved.
  * @param numberOfVertices of the graph.
+ * @param minimumValue, the value of the first entry of the density.
  * @param lowerBound, the minimum value for accepting the step.
  * @param upperBound, the maximum value for accepting the step.
  * @param numberOfCounts, how often has a number been added to the density.
  */
-void MCSimulation::saveDensity(double density[], const std::string directory,
-                                int numberOfVertices, int lowerBound, int upperBound, unsigned long long int numberOfCounts) {
+void MCSimulation::saveDensity(double density[], const std::string directory, int numberOfVertices,
+                                int minimumValue, int lowerBound, int upperBound, unsigned long long int numberOfCounts) {
     double p = 0.0;
     double err = 0.0;
     int i = 0;
@@ -342,16 +1040,16 @@ void MCSimulation::saveDensity(double density[], const std::string directory,
                                                + numToStr(lowerBound) + "_"
                                                + numToStr(upperBound) + ".dat").c_str());
     // sum over the density and sum it up
-    for (i = (lowerBound - 1); i < (upperBound); i++) {
+    for (i = (lowerBound - minimumValue); i <= (upperBound - minimumValue); i++) {
         sum += density[i];
     }
     // print the density plus the error
-    for (i = (lowerBound - 1); i < (upperBound); i++) {
+    for (i = (lowerBound - minimumValue); i <= (upperBound - minimumValue); i++) {
         if (density[i] != 0) {
             // just save, if density[i] is not zero
             p = density[i] / (sum);
             err = sqrt((p * (1.0 - p)) / ((double) numberOfCounts - 1.0));
-            outfile << (i + 1) << " " << density[i] << " " << err << std::endl;
+            outfile << (i + minimumValue) << " " << density[i] << " " << err << std::endl;
         }
     }
     outfile.close();
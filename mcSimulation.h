@@ -21,15 +21,22 @@
 #ifndef MCSIMULATION_H_INCLUDED
 #define MCSIMULATION_H_INCLUDED
 
+#include <algorithm>
 #include <fstream>
+#include <map>
 #include <math.h>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include "abstractGraph.h"
+#include "acceptanceTable.h"
+#include "componentTracker.h"
 #include "edge.h"
 #include "graphGeneratorMakros.h"
 #include "histogram.h"
 #include "mcPresenter.h"
-#include "previousState.h"
 #include "strNumConv.h"
 
 class MCPresenter;
@@ -46,10 +53,40 @@ class MCPresenter;
 typedef struct {
     double temperature;
     double *density;
+    int minimumValue;
     double lowerBound;
     double upperBound;
+    AcceptanceTable *acceptance;
 } parameterCollector_type;
 
+/**
+ * Define a structure for one replica of the parallel tempering. The graph carries its
+ * own random number generator, hence both are exchanged between the temperatures.
+ */
+typedef struct {
+    double temperature;
+    AbstractGraph *graph;
+    AcceptanceTable *acceptance;
+    Histogram *histogram;
+    std::ofstream *outfile;
+} replica_type;
+
+/**
+ * Define a structure for one walker of the Wang-Landau algorithm in the window
+ * [lowerBound, upperBound], the density contains the logarithms of the density of states.
+ */
+typedef struct {
+    int lowerBound;
+    int upperBound;
+    double *density;
+    double modiFac;
+    bool saturated;
+    unsigned long long int step;
+    AbstractGraph *graph;
+    Histogram *histogram;
+    std::ofstream *outfile;
+} walker_type;
+
 /**
  * This class defines a Monte-Carlo Simulation for simulating graphs.
  */
@@ -76,6 +113,34 @@ public:
      */
     void simpleSampling(int numberOfGraphs);
 
+    /**
+     * Generate a set of graphs and calculate a histogram using the given number of threads.
+     * Each thread generates its share of the graphs with its own graph, random number stream,
+     * histogram and buffer for the lines of the graphs. The buffers are saved in the order
+     * of the threads and the histograms are added at the end. The streams require the
+     * xoshiro256** or the Philox generator.
+     *
+     * @param numberOfGraphs, how many graphs should be generated randomly.
+     * @param numberOfThreads, the number of threads.
+     */
+    void simpleSampling(int numberOfGraphs, int numberOfThreads);
+
+    /**
+     * Generate a set of ER graphs with the Newman-Ziff algorithm: the edges are inserted one by
+     * one in a random order, while the components are kept by a union-find structure. Hence one
+     * pass of each graph provides the size of the largest component for each number of edges
+     * M up to the cap mean + 6 sigma of the binomial distribution Binom(pairs, cMax / n), or all
+     * pairs, if this is smaller. The histograms P(S | M) can be convolved to each connectivity
+     * c <= cMax afterwards, the truncated tail has a weight below 1e-9:
+     * P_c(S) = sum_M binom(pairs, M) p^M (1 - p)^(pairs - M) P(S | M), with p = c / n.
+     *
+     * @param numberOfGraphs, how many graphs should be generated randomly.
+     * @param maximumConnectivity, the maximum connectivity of interest.
+     * @param digraph, true: the edges are ordered pairs and the components are weak, false: no digraph.
+     * @param loopsAllowed, true: loops enabled, false: loops disabled.
+     */
+    void newmanZiff(int numberOfGraphs, double maximumConnectivity, bool digraph, bool loopsAllowed);
+
     /**
      * Perform the simulation on one graph under one starting condition
      * using the Metropolis algorithm.
@@ -106,11 +171,80 @@ public:
      */
     void wangLandauAlgorithm(int lowerBound, int upperBound, int sweepsToEvaluate, double modiFacFinal);
 
+    /**
+     * Perform the Wang-Landau algorithm on overlapping windows of the value at once
+     * (replica-exchange Wang-Landau). Each window has its own walker, density and histogram
+     * and is advanced on its own thread with its own random number stream. After each
+     * sweepsToExchange sweeps the graphs of the neighboring windows i, i + 1 are exchanged,
+     * if both values lie in the overlap, with the probability
+     * min(1, g_i(S_i) g_i+1(S_i+1) / (g_i(S_i+1) g_i+1(S_i))). A window stops, as soon as its
+     * modification factor is below the final one, the files of each window equal those of
+     * the Wang-Landau algorithm. The streams require the xoshiro256** or the Philox generator.
+     *
+     * @param lowerBounds, the minimum values of the windows in increasing order.
+     * @param upperBounds, the maximum values of the windows in increasing order.
+     * @param numberOfWindows, the number of windows.
+     * @param sweepsToEvaluate, the number of sweeps after that the
+     *        histogram check is performed.
+     * @param modiFacFinal, the final modification factor.
+     * @param sweepsToExchange, the number of sweeps between two exchanges.
+     */
+    void replicaExchangeWangLandau(int lowerBounds[], int upperBounds[], int numberOfWindows,
+                                   int sweepsToEvaluate, double modiFacFinal, int sweepsToExchange);
+
+    /**
+     * Perform the Wang-Landau algorithm with multiple walkers in one window, which share the
+     * density and the histogram. Each walker is advanced on its own thread with its own graph
+     * and random number stream and adds to its own copy of the density. After each
+     * sweepsToEvaluate sweeps the differences of the copies are added to the shared density,
+     * the histograms of the walkers are added to the shared histogram and the modification
+     * factor is updated using the shared histogram, where the time t counts the sweeps of all
+     * walkers. The streams require the xoshiro256** or the Philox generator.
+     *
+     * @param lowerBound, the minimum value for accepting the step.
+     * @param upperBound, the maximum value for accepting the step.
+     * @param sweepsToEvaluate, the number of sweeps after that the
+     *       histogram check is performed.
+     * @param modiFacFinal, the final modification factor.
+     * @param numberOfWalkers, the number of walkers (and threads).
+     */
+    void multipleWalkerWangLandau(int lowerBound, int upperBound, int sweepsToEvaluate, double modiFacFinal,
+                                  int numberOfWalkers);
+
+    /**
+     * Perform the simulation on one graph per temperature using the Metropolis algorithm,
+     * where the graphs of neighboring temperatures are exchanged (parallel tempering).
+     * Each replica is advanced on its own thread with its own random number stream,
+     * after each sweepsToExchange sweeps the graphs of the neighbors i, i + 1 are exchanged
+     * with the probability min(1, exp((1 / T_i - 1 / T_i+1) * (S_i - S_i+1))).
+     * The streams require the xoshiro256** or the Philox generator.
+     *
+     * @param temperatures, the artificial temperatures, make sure temperature != 0.
+     * @param numberOfTemperatures, the number of temperatures.
+     * @param sweeps, how many sweeps should be recorded.
+     * @param equilibrationSweeps, number of sweeps to perform, until the simulation is equilibrated.
+     * @param sweepsToExchange, the number of sweeps between two exchanges.
+     */
+    void parallelTempering(double temperatures[], int numberOfTemperatures, int sweeps,
+                           int equilibrationSweeps, int sweepsToExchange);
+
 private:
     std::string directory;
     MCPresenter *simulationPresenter;
     Histogram *histogram;
 
+    /**
+     * Generate the given number of random graphs, save one line per graph and add the values
+     * to the given histogram.
+     *
+     * @param graph, pointer to the graph, which is generated randomly.
+     * @param firstGraph, the number of the first graph for the outfile.
+     * @param numberOfGraphs, how many graphs should be generated randomly.
+     * @param hist, pointer to the histogram.
+     * @param outfile, the stream for the lines of the graphs.
+     */
+    void sampleGraphs(AbstractGraph *graph, int firstGraph, int numberOfGraphs, Histogram *hist, std::ostream *outfile);
+
     /**
      * Generate the next state for the simulation. This function generates the candidate graph,
      * calculates the size of the largest components for both graphs and sets the next state.
@@ -127,6 +261,7 @@ private:
      * @param algorithm, the used algorithm for importance sampling.
      * @param currentValue, value for the current state.
      * @param candidateValue, value for the candidate graph.
+     * @param randomInteger, the random integer drawn for this decision.
      * @param parameters, the required parameters for the accept / reject decision.
      *
      * @return true: accept the candidate graph, false: reject the candidate graph.
@@ -134,7 +269,139 @@ private:
      * @exception Invalid algorithm number.
      */
     bool acceptNewState(int algorithm, double currentValue, double candidateValue,
-                        parameterCollector_type parameters);
+                        long randomInteger, parameterCollector_type parameters);
+
+    /**
+     * Calculate the maximum value of a candidate graph, which may be accepted
+     * with the given random integer. Each bigger value is rejected by acceptNewState.
+     * Only this upper bound stops the calculation of the candidate value early: the lower
+     * limits, i.e. the rejection of smaller values for T < 0 and at the lower bound of the
+     * Wang-Landau window, are left to acceptNewState.
+     *
+     * @param algorithm, the used algorithm for importance sampling.
+     * @param currentValue, value for the current state.
+     * @param randomInteger, the random integer drawn for this decision.
+     * @param parameters, the required parameters for the accept / reject decision.
+     *
+     * @return the maximum value, which may be accepted.
+     *
+     * @exception Invalid algorithm number.
+     */
+    double maximumAcceptedValue(int algorithm, double currentValue, long randomInteger,
+                                parameterCollector_type parameters);
+
+    /**
+     * Advance all replicas by the given number of sweeps, each replica on its own thread.
+     *
+     * @param replicas, the replicas ordered by the inverse temperature.
+     * @param numberOfTemperatures, the number of replicas.
+     * @param sweeps, the number of sweeps to perform.
+     * @param firstSweep, the number of the first sweep for the outfiles.
+     * @param record, true: record each sweep, false: equilibrate.
+     */
+    void advanceReplicas(replica_type replicas[], int numberOfTemperatures, int sweeps, int firstSweep, bool record);
+
+    /**
+     * Advance one replica by the given number of sweeps using the Metropolis algorithm.
+     *
+     * @param replica, pointer to the replica.
+     * @param sweeps, the number of sweeps to perform.
+     * @param firstSweep, the number of the first sweep for the outfile.
+     * @param record, true: record each sweep, false: equilibrate.
+     */
+    void advanceReplica(replica_type *replica, int sweeps, int firstSweep, bool record);
+
+    /**
+     * Exchange the graphs of the neighboring replicas i, i + 1 with the parallel tempering
+     * probability, where i = offset, offset + 2, ...
+     *
+     * @param replicas, the replicas ordered by the inverse temperature.
+     * @param numberOfTemperatures, the number of replicas.
+     * @param offset, 0: exchange the even pairs, 1: exchange the odd pairs.
+     * @param attempts, the number of attempted exchanges of each pair.
+     * @param accepted, the number of accepted exchanges of each pair.
+     */
+    void exchangeReplicas(replica_type replicas[], int numberOfTemperatures, int offset,
+                          unsigned long long int attempts[], unsigned long long int accepted[]);
+
+    /**
+     * Set up a Wang-Landau walker in the given window: allocate the density and the histogram,
+     * generate a graph with a value in the window and open the outfile.
+     *
+     * @param lowerBound, the minimum value for accepting the step.
+     * @param upperBound, the maximum value for accepting the step.
+     * @param sweepsToEvaluate, the number of sweeps after that the
+     *        histogram check is performed.
+     * @param modiFacFinal, the final modification factor.
+     * @param gen, the random number generator of the graph, NULL == the generator of the presenter.
+     * @param suffix, the suffix of the name of the outfile.
+     *
+     * @return pointer to the walker.
+     */
+    walker_type *initWalker(int lowerBound, int upperBound, int sweepsToEvaluate, double modiFacFinal,
+                            RandomGenerator *gen, std::string suffix);
+
+    /**
+     * Perform the Wang-Landau algorithm with the given walker for the given number of sweeps
+     * or until the modification factor is below the final one.
+     *
+     * @param walker, pointer to the walker.
+     * @param sweepsToEvaluate, the number of sweeps after that the
+     *        histogram check is performed.
+     * @param modiFacFinal, the final modification factor.
+     * @param sweeps, the maximum number of sweeps to perform.
+     * @param schedule, true: update the modification factor using the histogram of the walker,
+     *                  false: the modification factor is updated by the caller.
+     */
+    void advanceWalker(walker_type *walker, int sweepsToEvaluate, double modiFacFinal, int sweeps, bool schedule);
+
+    /**
+     * Advance all walkers, whose modification factor is not below the final one,
+     * by the given number of sweeps, each walker on its own thread.
+     *
+     * @param walkers, the walkers of the windows.
+     * @param numberOfWindows, the number of windows.
+     * @param sweepsToEvaluate, the number of sweeps after that the
+     *        histogram check is performed.
+     * @param modiFacFinal, the final modification factor.
+     * @param sweeps, the maximum number of sweeps to perform.
+     * @param schedule, true: update the modification factor using the histogram of the walker,
+     *                  false: the modification factor is updated by the caller.
+     */
+    void advanceWalkers(walker_type *walkers[], int numberOfWindows, int sweepsToEvaluate,
+                        double modiFacFinal, int sweeps, bool schedule);
+
+    /**
+     * Exchange the graphs of the neighboring windows i, i + 1 with the replica-exchange
+     * Wang-Landau probability, where i = offset, offset + 2, ... Both windows must not be
+     * finished and both values must lie in the overlap of the windows.
+     *
+     * @param walkers, the walkers of the windows.
+     * @param numberOfWindows, the number of windows.
+     * @param offset, 0: exchange the even pairs, 1: exchange the odd pairs.
+     * @param modiFacFinal, the final modification factor.
+     * @param attempts, the number of attempted exchanges of each pair.
+     * @param accepted, the number of accepted exchanges of each pair.
+     */
+    void exchangeWalkers(walker_type *walkers[], int numberOfWindows, int offset, double modiFacFinal,
+                         unsigned long long int attempts[], unsigned long long int accepted[]);
+
+    /**
+     * Save the histogram and the density of the given walker and free it.
+     *
+     * @param walker, pointer to the walker.
+     * @param sweepsToEvaluate, the number of sweeps after that the
+     *        histogram check was performed.
+     * @param modiFacFinal, the final modification factor.
+     */
+    void finishWalker(walker_type *walker, int sweepsToEvaluate, double modiFacFinal);
+
+    /**
+     * Free the given walker without saving its results.
+     *
+     * @param walker, pointer to the walker.
+     */
+    void deleteWalker(walker_type *walker);
 
     /**
      * This function saves the densities obtained by the Wang-Landau algorithm.
@@ -142,11 +409,12 @@ private:
      * @param density, which must be saved.
      * @param directory where the result should be saved.
      * @param numberOfVertices of the graph.
+     * @param minimumValue, the value of the first entry of the density.
      * @param lowerBound, the minimum value for accepting the step.
      * @param upperBound, the maximum value for accepting the step.
      * @param numberOfCounts, how often has a number been added to the density.
      */
-    void saveDensity(double density[], const std::string directory, int numberOfVertices,
+    void saveDensity(double density[], const std::string directory, int numberOfVertices, int minimumValue,
                       int lowerBound, int upperBound, unsigned long long int numberOfCounts);
 };
 
@@ -0,0 +1,300 @@
+/*
+ * observable.cpp
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "observable.h"
+
+/******************* Observable *******************/
+
+/**
+ * Constructor for setting up the observable.
+ *
+ * @param n number of vertices.
+ */
+Observable::Observable(int n) {
+    numberOfVertices = n;
+}
+
+/**
+ * Destructor.
+ */
+Observable::~Observable() {
+}
+
+/**
+ * Return the value of the proposed candidate graph of the given graph. The calculation
+ * may stop, as soon as the value exceeds the given bound. By default the candidate graph
+ * is applied, such that the counts of the graph are updated by the changed edges.
+ *
+ * @param graph pointer to the given graph.
+ * @param bound the maximum value, which is of interest.
+ *
+ * @return the value of the candidate graph or a value bigger than the bound.
+ */
+int Observable::getCandidateValue(AbstractGraph *graph, int bound) {
+    graph->applyCandidateGraph();
+    return(getValue(graph)); // virtual, implemented by the observable
+}
+
+/**
+ * Return the minimum value of a graph (default: 0).
+ *
+ * @return the minimum value.
+ */
+int Observable::getMinimumValue() {
+    return(0);
+}
+
+/**
+ * Return the maximum value of a graph (default: number of vertices).
+ *
+ * @return the maximum value.
+ */
+int Observable::getMaximumValue() {
+    return(numberOfVertices);
+}
+
+/**
+ * Return the maximum absolute difference of the values of a graph and its candidate graph
+ * (default: number of vertices).
+ *
+ * @return the maximum difference.
+ */
+int Observable::getMaximumDifference() {
+    return(numberOfVertices);
+}
+
+/******************* LargestComponent *******************/
+
+/**
+ * Constructor for setting up the observable.
+ *
+ * @param n number of vertices.
+ */
+LargestComponent::LargestComponent(int n)
+: Observable(n) { // call super constructor
+}
+
+/**
+ * Return the size of the largest component of the given graph.
+ *
+ * @param graph pointer to the given graph.
+ *
+ * @return the size of the largest component.
+ */
+int LargestComponent::getValue(AbstractGraph *graph) {
+    return(graph->getSizeOfLargestComponent());
+}
+
+/**
+ * Return the size of the largest component of the proposed candidate graph,
+ * the search stops as soon as a component is bigger than the given bound.
+ *
+ * @param graph pointer to the given graph.
+ * @param bound the maximum size, which is of interest.
+ *
+ * @return the size of the largest component of the candidate graph
+ *       or a value bigger than the bound.
+ */
+int LargestComponent::getCandidateValue(AbstractGraph *graph, int bound) {
+    return(graph->evaluateCandidateGraph(bound));
+}
+
+/**
+ * Return the minimum value of a graph, which is one.
+ *
+ * @return the minimum value.
+ */
+int LargestComponent::getMinimumValue() {
+    return(1);
+}
+
+/******************* SecondLargestComponent *******************/
+
+/**
+ * Constructor for setting up the observable.
+ *
+ * @param n number of vertices.
+ */
+SecondLargestComponent::SecondLargestComponent(int n)
+: Observable(n) { // call super constructor
+}
+
+/**
+ * Return the size of the second largest component of the given graph.
+ * The sizes below the largest one are searched in the histogram of the sizes.
+ *
+ * @param graph pointer to the given graph.
+ *
+ * @return the size of the second largest component.
+ */
+int SecondLargestComponent::getValue(AbstractGraph *graph) {
+    int size = graph->getSizeOfLargestComponent();
+    if ((size > 0) && (graph->getNumberOfComponentsOfSize(size) > 1)) {
+        return(size);
+    }
+    for (size = size - 1; size > 0; size--) {
+        if (graph->getNumberOfComponentsOfSize(size) > 0) {
+            return(size);
+        }
+    }
+    return(0);
+}
+
+/**
+ * Return the maximum value of a graph, which is half of the number of vertices.
+ *
+ * @return the maximum value.
+ */
+int SecondLargestComponent::getMaximumValue() {
+    return(numberOfVertices / 2);
+}
+
+/******************* NumberOfComponents *******************/
+
+/**
+ * Constructor for setting up the observable.
+ *
+ * @param n number of vertices.
+ */
+NumberOfComponents::NumberOfComponents(int n)
+: Observable(n) { // call super constructor
+}
+
+/**
+ * Return the number of components of the given graph.
+ *
+ * @param graph pointer to the given graph.
+ *
+ * @return the number of components.
+ */
+int NumberOfComponents::getValue(AbstractGraph *graph) {
+    return(graph->getNumberOfComponents());
+}
+
+/**
+ * Return the minimum value of a graph, which is one.
+ *
+ * @return the minimum value.
+ */
+int NumberOfComponents::getMinimumValue() {
+    return(1);
+}
+
+/******************* IsolatedVertices *******************/
+
+/**
+ * Constructor for setting up the observable.
+ *
+ * @param n number of vertices.
+ */
+IsolatedVertices::IsolatedVertices(int n)
+: Observable(n) { // call super constructor
+}
+
+/**
+ * Return the number of isolated vertices of the given graph.
+ *
+ * @param graph pointer to the given graph.
+ *
+ * @return the number of isolated vertices.
+ */
+int IsolatedVertices::getValue(AbstractGraph *graph) {
+    return(graph->getNumberOfIsolatedVertices());
+}
+
+/******************* NumberOfEdges *******************/
+
+/**
+ * Constructor for setting up the observable.
+ *
+ * @param n number of vertices.
+ * @param digraph true: digraph, false: no digraph.
+ * @param loopsAllowed true: loops enabled, false: loops disabled.
+ */
+NumberOfEdges::NumberOfEdges(int n, bool digraph, bool loopsAllowed)
+: Observable(n) { // call super constructor
+    isDigraph = digraph;
+    loopsEnabled = loopsAllowed;
+}
+
+/**
+ * Return the number of edges of the given graph.
+ *
+ * @param graph pointer to the given graph.
+ *
+ * @return the number of edges.
+ */
+int NumberOfEdges::getValue(AbstractGraph *graph) {
+    return(graph->getNumberOfEdges());
+}
+
+/**
+ * Return the number of edges of the complete graph.
+ *
+ * @return the maximum value.
+ */
+int NumberOfEdges::getMaximumValue() {
+    // the presenter rejects graphs, whose number of pairs exceeds MAXIMUMNUMBEROFVALUES
+    return((int) NumberOfEdges::getNumberOfPairs());
+}
+
+/**
+ * Return the number of edges of the complete graph computed in 64 bits,
+ * which exceeds the range of int for large graphs.
+ *
+ * @return the number of pairs, which may be an edge.
+ */
+long long int NumberOfEdges::getNumberOfPairs() {
+    long long int n = numberOfVertices;
+    long long int pairs = isDigraph ? n * (n - 1) : n * (n - 1) / 2;
+    return(pairs + (loopsEnabled ? n : 0));
+}
+
+/**
+ * Return the maximum number of edges of one vertex, which may be changed by one step.
+ *
+ * @return the maximum difference.
+ */
+int NumberOfEdges::getMaximumDifference() {
+    int neighbors = isDigraph ? 2 * (numberOfVertices - 1) : numberOfVertices - 1;
+    return(neighbors + (loopsEnabled ? 1 : 0));
+}
+
+/******************* TwoCoreSize *******************/
+
+/**
+ * Constructor for setting up the observable.
+ *
+ * @param n number of vertices.
+ */
+TwoCoreSize::TwoCoreSize(int n)
+: Observable(n) { // call super constructor
+}
+
+/**
+ * Return the size of the 2-core of the given graph.
+ *
+ * @param graph pointer to the given graph.
+ *
+ * @return the size of the 2-core.
+ */
+int TwoCoreSize::getValue(AbstractGraph *graph) {
+    return(graph->getSizeOfTwoCore());
+}
@@ -0,0 +1,296 @@
+/*
+ * observable.h
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OBSERVABLE_H_INCLUDED
+#define OBSERVABLE_H_INCLUDED
+
+#include "abstractGraph.h"
+
+/**
+ * Define the maximum number of values of an observable, because the histograms and
+ * the density of the Wang-Landau algorithm have one bin per value.
+ */
+#define MAXIMUMNUMBEROFVALUES 100000000
+
+/**
+ * Define an integer valued observable of a graph, which is queried by the simulation
+ * once per step. The observables only read the counts, which are kept by the graph:
+ * the number of edges and the degrees are updated by each change of an edge, the
+ * components are either tracked or obtained by one component pass, which is shared
+ * by all component observables until the graph is changed.
+ */
+class Observable {
+public:
+    /**
+     * Constructor for setting up the observable.
+     *
+     * @param n number of vertices.
+     */
+    Observable(int n);
+
+    /**
+     * Destructor.
+     */
+    virtual ~Observable();
+
+    /**
+     * Return the value of the given graph.
+     * This function is abstract and must be implemented by inheriting classes.
+     *
+     * @param graph pointer to the given graph.
+     *
+     * @return the value of the graph.
+     */
+    virtual int getValue(AbstractGraph *graph) = 0;
+
+    /**
+     * Return the value of the proposed candidate graph of the given graph. The calculation
+     * may stop, as soon as the value exceeds the given bound. By default the candidate graph
+     * is applied, such that the counts of the graph are updated by the changed edges.
+     *
+     * @param graph pointer to the given graph.
+     * @param bound the maximum value, which is of interest.
+     *
+     * @return the value of the candidate graph or a value bigger than the bound.
+     */
+    virtual int getCandidateValue(AbstractGraph *graph, int bound);
+
+    /**
+     * Return the minimum value of a graph (default: 0).
+     *
+     * @return the minimum value.
+     */
+    virtual int getMinimumValue();
+
+    /**
+     * Return the maximum value of a graph (default: number of vertices).
+     *
+     * @return the maximum value.
+     */
+    virtual int getMaximumValue();
+
+    /**
+     * Return the maximum absolute difference of the values of a graph and its candidate graph
+     * (default: number of vertices).
+     *
+     * @return the maximum difference.
+     */
+    virtual int getMaximumDifference();
+
+protected:
+    int numberOfVertices;
+};
+
+/**
+ * Define the size of the largest component.
+ */
+class LargestComponent : public Observable {
+public:
+    /**
+     * Constructor for setting up the observable.
+     *
+     * @param n number of vertices.
+     */
+    LargestComponent(int n);
+
+    /**
+     * Return the size of the largest component of the given graph.
+     *
+     * @param graph pointer to the given graph.
+     *
+     * @return the size of the largest component.
+     */
+    int getValue(AbstractGraph *graph);
+
+    /**
+     * Return the size of the largest component of the proposed candidate graph,
+     * the search stops as soon as a component is bigger than the given bound.
+     *
+     * @param graph pointer to the given graph.
+     * @param bound the maximum size, which is of interest.
+     *
+     * @return the size of the largest component of the candidate graph
+     *       or a value bigger than the bound.
+     */
+    int getCandidateValue(AbstractGraph *graph, int bound);
+
+    /**
+     * Return the minimum value of a graph, which is one.
+     *
+     * @return the minimum value.
+     */
+    int getMinimumValue();
+};
+
+/**
+ * Define the size of the second largest component, which is zero for a graph
+ * with one component and equals the largest size, if it occurs twice.
+ */
+class SecondLargestComponent : public Observable {
+public:
+    /**
+     * Constructor for setting up the observable.
+     *
+     * @param n number of vertices.
+     */
+    SecondLargestComponent(int n);
+
+    /**
+     * Return the size of the second largest component of the given graph.
+     * The sizes below the largest one are searched in the histogram of the sizes.
+     *
+     * @param graph pointer to the given graph.
+     *
+     * @return the size of the second largest component.
+     */
+    int getValue(AbstractGraph *graph);
+
+    /**
+     * Return the maximum value of a graph, which is half of the number of vertices.
+     *
+     * @return the maximum value.
+     */
+    int getMaximumValue();
+};
+
+/**
+ * Define the number of components.
+ */
+class NumberOfComponents : public Observable {
+public:
+    /**
+     * Constructor for setting up the observable.
+     *
+     * @param n number of vertices.
+     */
+    NumberOfComponents(int n);
+
+    /**
+     * Return the number of components of the given graph.
+     *
+     * @param graph pointer to the given graph.
+     *
+     * @return the number of components.
+     */
+    int getValue(AbstractGraph *graph);
+
+    /**
+     * Return the minimum value of a graph, which is one.
+     *
+     * @return the minimum value.
+     */
+    int getMinimumValue();
+};
+
+/**
+ * Define the number of vertices without an edge to another vertex.
+ */
+class IsolatedVertices : public Observable {
+public:
+    /**
+     * Constructor for setting up the observable.
+     *
+     * @param n number of vertices.
+     */
+    IsolatedVertices(int n);
+
+    /**
+     * Return the number of isolated vertices of the given graph.
+     *
+     * @param graph pointer to the given graph.
+     *
+     * @return the number of isolated vertices.
+     */
+    int getValue(AbstractGraph *graph);
+};
+
+/**
+ * Define the number of edges.
+ */
+class NumberOfEdges : public Observable {
+public:
+    /**
+     * Constructor for setting up the observable.
+     *
+     * @param n number of vertices.
+     * @param digraph true: digraph, false: no digraph.
+     * @param loopsAllowed true: loops enabled, false: loops disabled.
+     */
+    NumberOfEdges(int n, bool digraph, bool loopsAllowed);
+
+    /**
+     * Return the number of edges of the given graph.
+     *
+     * @param graph pointer to the given graph.
+     *
+     * @return the number of edges.
+     */
+    int getValue(AbstractGraph *graph);
+
+    /**
+     * Return the number of edges of the complete graph.
+     *
+     * @return the maximum value.
+     */
+    int getMaximumValue();
+
+    /**
+     * Return the number of edges of the complete graph computed in 64 bits,
+     * which exceeds the range of int for large graphs.
+     *
+     * @return the number of pairs, which may be an edge.
+     */
+    long long int getNumberOfPairs();
+
+    /**
+     * Return the maximum number of edges of one vertex, which may be changed by one step.
+     *
+     * @return the maximum difference.
+     */
+    int getMaximumDifference();
+
+private:
+    bool isDigraph;
+    bool loopsEnabled;
+};
+
+/**
+ * Define the number of vertices of the 2-core (undirected graphs only).
+ */
+class TwoCoreSize : public Observable {
+public:
+    /**
+     * Constructor for setting up the observable.
+     *
+     * @param n number of vertices.
+     */
+    TwoCoreSize(int n);
+
+    /**
+     * Return the size of the 2-core of the given graph.
+     *
+     * @param graph pointer to the given graph.
+     *
+     * @return the size of the 2-core.
+     */
+    int getValue(AbstractGraph *graph);
+};
+
+#endif // OBSERVABLE_H_INCLUDED
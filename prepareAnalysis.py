@@ -68,10 +68,10 @@ def prepareAnalysis(arguments):
 		arg = arg.split()
 		if (arg[7] == "0"):
 			# ER graph
-			indexDelta = 9
+			indexDelta = 11
 		elif (arg[7] == "1"):
 			# SBM graph
-			indexDelta = 11
+			indexDelta = 13
 		if (arg[indexDelta] == "0"):
 			# treat simple sampling
 			directory = arg[2]
@@ -42,6 +42,22 @@ def simpleSampling(disp, result, initialize):
 	
 	return(result)
 
+## Process simple sampling using multiple threads.
+def threadedSimpleSampling(disp, result, initialize):
+	samples = raw_input(dispMessage(disp, "number of samples\n")) ################################################## tss1
+	threads = raw_input(dispMessage(disp, "number of threads\n")) ################################################## tss2
+	result.append(initialize + " 7 " + samples + " " + threads)
+	
+	return(result)
+
+## Process simple sampling of ER graphs for all numbers of edges using the Newman-Ziff algorithm.
+def newmanZiff(disp, result, initialize):
+	samples = raw_input(dispMessage(disp, "number of samples\n")) ################################################## nz1
+	maximumConnectivity = raw_input(dispMessage(disp, "enter the maximum connectivity\n")) ######################### nz2
+	result.append(initialize + " 8 " + samples + " " + maximumConnectivity)
+	
+	return(result)
+
 ## Process importance sampling with the Metropolis algorithm.
 def metropolisAlgorithm(disp, result, initialize):
 	tempMin = float(raw_input(dispMessage(disp, "enter minimum temperature\n"))) ################################## is1
@@ -56,6 +72,23 @@ def metropolisAlgorithm(disp, result, initialize):
 	
 	return(result)
 
+## Process importance sampling with parallel tempering, all temperatures are simulated by one program.
+def parallelTempering(disp, result, initialize):
+	tempMin = float(raw_input(dispMessage(disp, "enter minimum temperature\n"))) ################################## pt1
+	tempMax = float(raw_input(dispMessage(disp, "enter maximum temperature\n"))) ################################## pt2
+	tempStep = float(raw_input(dispMessage(disp, "enter temperature step\n"))) #################################### pt3
+	samples = raw_input(dispMessage(disp, "number of samples\n")) ################################################## pt4
+	equi = raw_input(dispMessage(disp, "number of steps for equilibration\n")) ##################################### pt5
+	exchange = raw_input(dispMessage(disp, "number of sweeps between the exchanges\n")) ############################ pt6
+	mult = getMaxMultiplier(tempMin, tempMax, tempStep)
+	temperatures = []
+	for temp in arange(tempMin * mult, tempMax * mult, tempStep * mult):
+		if (temp != 0):
+			temperatures.append(str(temp / mult))
+	result.append(initialize + " 4 " + str(len(temperatures)) + " " + " ".join(temperatures) + " " + samples + " " + equi + " " + exchange)
+	
+	return(result)
+
 ## Process the Wang-Landau algorithm.
 def wangLandauAlgorithm(disp, result, initialize):
 	lowerBound = raw_input(dispMessage(disp, "enter lower bound\n")) ############################################### wl1
@@ -66,6 +99,32 @@ def wangLandauAlgorithm(disp, result, initialize):
 	
 	return(result)
 
+## Process the Wang-Landau algorithm with replica exchanges, all windows are simulated by one program.
+def replicaExchangeWangLandau(disp, result, initialize):
+	windows = int(raw_input(dispMessage(disp, "enter the number of windows\n"))) ################################### rewl1
+	bounds = []
+	for i in range(windows):
+		lowerBound = raw_input(dispMessage(disp, "enter lower bound\n")) ########################################### rewl2
+		upperBound = raw_input(dispMessage(disp, "enter upper bound\n")) ########################################### rewl3
+		bounds.append(lowerBound + " " + upperBound)
+	sweepsToEvaluate = raw_input(dispMessage(disp, "enter the number of sweeps for the evaluation\n")) ############# rewl4
+	modiFacFinal = raw_input(dispMessage(disp, "enter the final modification factor\n")) ########################### rewl5
+	exchange = raw_input(dispMessage(disp, "number of sweeps between the exchanges\n")) ############################ rewl6
+	result.append(initialize + " 5 " + str(windows) + " " + " ".join(bounds) + " " + sweepsToEvaluate + " " + modiFacFinal + " " + exchange)
+	
+	return(result)
+
+## Process the Wang-Landau algorithm with multiple walkers in one window.
+def multipleWalkerWangLandau(disp, result, initialize):
+	lowerBound = raw_input(dispMessage(disp, "enter lower bound\n")) ############################################### mwl1
+	upperBound = raw_input(dispMessage(disp, "enter upper bound\n")) ############################################### mwl2
+	sweepsToEvaluate = raw_input(dispMessage(disp, "enter the number of sweeps for the evaluation\n")) ############# mwl3
+	modiFacFinal = raw_input(dispMessage(disp, "enter the final modification factor\n")) ########################### mwl4
+	walkers = raw_input(dispMessage(disp, "enter the number of walkers\n")) ######################################## mwl5
+	result.append(initialize + " 6 " + lowerBound + " " + upperBound + " " + sweepsToEvaluate + " " + modiFacFinal + " " + walkers)
+	
+	return(result)
+
 ## Verification of equilibration.
 def equilibrate(disp, result, initialize):
 	tempMin = float(raw_input(dispMessage(disp, "enter minimum temperature\n"))) ################################## eq1
@@ -85,9 +144,9 @@ def initSystem(disp):
 	loopsAllowed = raw_input(dispMessage(disp, "are loops allowed y/n\n")) ######################################### s2
 	directory = raw_input(dispMessage(disp, "enter directory\n")) ################################################## s3
 	vertices = raw_input(dispMessage(disp, "enter the number of vertices of the graph\n")) ######################### s4
-	generator = raw_input(dispMessage(disp, "enter the number of the generator to use\n")) ######################### s5
+	generator = raw_input(dispMessage(disp, "enter the number of the generator to use (0: default, 1: xoshiro256**, 2: Philox)\n")) ###### s5
 	seed = raw_input(dispMessage(disp, "enter a seed for the random number generator\n")) ########################## s6
-	value = raw_input(dispMessage(disp, "enter the value to use\n")) ############################################### s7
+	value = raw_input(dispMessage(disp, "enter the value to use (0: largest component, 1: second largest component, 2: components, 3: isolated vertices, 4: edges, 5: 2-core)\n")) ###### s7
 	graph = raw_input(dispMessage(disp, "enter the number of graph to use\n")) ##################################### s8
 	firstConnectivity = secondConnectivity = numberOfBlocks = initialize = ""
 	if (int(graph) == 0):
@@ -98,6 +157,12 @@ def initSystem(disp):
 		secondConnectivity = raw_input(dispMessage(disp, "enter intrablock connectivity of the graph\n")) ########## s11
 		numberOfBlocks = raw_input(dispMessage(disp, "enter the number of blocks\n")) ############################## s12
 		initialize = isDigraph + " " + loopsAllowed + " " + directory + " " + vertices + " " + generator + " " + seed + " " + value + " " + graph + " " + firstConnectivity + " " + secondConnectivity + " " + numberOfBlocks
+	storage = raw_input(dispMessage(disp, "enter the storage of the edges (0: adjacency matrix, 1: adjacency list, 2: bit matrix)\n")) ###### s13
+	components = raw_input(dispMessage(disp, "enter how the components are obtained (0: search, 1: tracking, 2: dynamic connectivity)\n")) ###### s14
+	initialize = initialize + " " + storage + " " + components
+	if (isDigraph == "y"):
+		digraphComponents = raw_input(dispMessage(disp, "enter the components of the digraph (0: reachable, 1: weak, 2: strong)\n")) ###### s15
+		initialize = initialize + " " + digraphComponents
 	
 	return(initialize)
 
@@ -115,6 +180,16 @@ def doAction(disp, initialize):
 			result = equilibrate(disp, result, initialize)
 		if (action == 3):
 			result = wangLandauAlgorithm(disp, result, initialize)
+		if (action == 4):
+			result = parallelTempering(disp, result, initialize)
+		if (action == 5):
+			result = replicaExchangeWangLandau(disp, result, initialize)
+		if (action == 6):
+			result = multipleWalkerWangLandau(disp, result, initialize)
+		if (action == 7):
+			result = threadedSimpleSampling(disp, result, initialize)
+		if (action == 8):
+			result = newmanZiff(disp, result, initialize)
 	
 	return(result)
 
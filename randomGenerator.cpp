@@ -19,15 +19,310 @@
  */
 
 #include "randomGenerator.h"
+#include "strNumConv.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+// the AVX2 kernels are compiled for each x86 build and used, if the processor supports them
+#define RANDOMGENERATORAVX2
+#endif
+
+/**
+ * Advance the given state of xoshiro256**.
+ *
+ * @param s the state of four words.
+ *
+ * @return 64 random bits.
+ */
+static inline uint64_t nextXoshiro(uint64_t *s) {
+    uint64_t result = s[1] * 5;
+    result = ((result << 7) | (result >> 57)) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    return(result);
+}
+
+/**
+ * Encrypt the counters (counter + b, stream) of the given blocks with ten Philox4x32 rounds.
+ *
+ * @param key the 64 bit key.
+ * @param counter the lower half of the 128 bit counter of the first block.
+ * @param stream the upper half of the 128 bit counter.
+ * @param words two random words per block.
+ * @param blocks the number of blocks.
+ */
+static void philoxBlocks(const uint32_t key[2], uint64_t counter, uint64_t stream, uint64_t *words, int blocks) {
+    for (int b = 0; b < blocks; b++) {
+        uint64_t c = counter + b;
+        uint32_t x[4] = {(uint32_t) c, (uint32_t) (c >> 32), (uint32_t) stream, (uint32_t) (stream >> 32)};
+        uint32_t k0 = key[0];
+        uint32_t k1 = key[1];
+        for (int round = 0; round < 10; round++) {
+            uint64_t p0 = ((uint64_t) 0xD2511F53U) * x[0];
+            uint64_t p1 = ((uint64_t) 0xCD9E8D57U) * x[2];
+            uint32_t y0 = ((uint32_t) (p1 >> 32)) ^ x[1] ^ k0;
+            uint32_t y2 = ((uint32_t) (p0 >> 32)) ^ x[3] ^ k1;
+            x[0] = y0;
+            x[1] = (uint32_t) p1;
+            x[2] = y2;
+            x[3] = (uint32_t) p0;
+            // bump the key with the Weyl sequence
+            k0 += 0x9E3779B9U;
+            k1 += 0xBB67AE85U;
+        }
+        words[2 * b] = (((uint64_t) x[1]) << 32) | x[0];
+        words[2 * b + 1] = (((uint64_t) x[3]) << 32) | x[2];
+    }
+}
 
 /**
- * Constructor for the RandomGenerator.
+ * Return the Bernoulli trials of 32 random words as mask, the lower and the upper
+ * half of word k are the trials 2 * k and 2 * k + 1.
+ *
+ * @param words 32 random words.
+ * @param threshold a trial succeeds, if its 32 bits are smaller, 0 < threshold < 2^32.
+ *
+ * @return the mask of the successful trials.
+ */
+static uint64_t bernoulliMask(const uint64_t *words, uint64_t threshold) {
+    uint64_t mask = 0;
+    for (int k = 0; k < 32; k++) {
+        mask |= ((uint64_t) ((words[k] & 0xFFFFFFFFULL) < threshold)) << (2 * k);
+        mask |= ((uint64_t) ((words[k] >> 32) < threshold)) << (2 * k + 1);
+    }
+    return(mask);
+}
+
+#ifdef RANDOMGENERATORAVX2
+/**
+ * Encrypt the counters of the given blocks like philoxBlocks, four blocks per vector.
+ *
+ * @param key the 64 bit key.
+ * @param counter the lower half of the 128 bit counter of the first block.
+ * @param stream the upper half of the 128 bit counter.
+ * @param words two random words per block.
+ * @param blocks the number of blocks.
+ */
+__attribute__((target("avx2")))
+static void philoxBlocksAVX2(const uint32_t key[2], uint64_t counter, uint64_t stream, uint64_t *words, int blocks) {
+    // each 64 bit lane holds one 32 bit word of the block in its lower half
+    const __m256i lower = _mm256_set1_epi64x(0xFFFFFFFFLL);
+    const __m256i m0 = _mm256_set1_epi64x(0xD2511F53LL);
+    const __m256i m1 = _mm256_set1_epi64x(0xCD9E8D57LL);
+    int b = 0;
+    for (; b + 4 <= blocks; b += 4) {
+        uint64_t c = counter + b;
+        __m256i x0 = _mm256_set_epi64x((uint32_t) (c + 3), (uint32_t) (c + 2), (uint32_t) (c + 1), (uint32_t) c);
+        __m256i x1 = _mm256_set_epi64x((c + 3) >> 32, (c + 2) >> 32, (c + 1) >> 32, c >> 32);
+        __m256i x2 = _mm256_set1_epi64x((uint32_t) stream);
+        __m256i x3 = _mm256_set1_epi64x(stream >> 32);
+        uint32_t k0 = key[0];
+        uint32_t k1 = key[1];
+        for (int round = 0; round < 10; round++) {
+            __m256i p0 = _mm256_mul_epu32(x0, m0);
+            __m256i p1 = _mm256_mul_epu32(x2, m1);
+            x0 = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p1, 32), x1), _mm256_set1_epi64x(k0));
+            x1 = _mm256_and_si256(p1, lower);
+            x2 = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p0, 32), x3), _mm256_set1_epi64x(k1));
+            x3 = _mm256_and_si256(p0, lower);
+            k0 += 0x9E3779B9U;
+            k1 += 0xBB67AE85U;
+        }
+        __m256i first = _mm256_or_si256(_mm256_slli_epi64(x1, 32), x0);
+        __m256i second = _mm256_or_si256(_mm256_slli_epi64(x3, 32), x2);
+        // interleave to first_0, second_0, first_1, second_1, ...
+        __m256i low = _mm256_unpacklo_epi64(first, second);
+        __m256i high = _mm256_unpackhi_epi64(first, second);
+        _mm256_storeu_si256((__m256i *) (words + 2 * b), _mm256_permute2x128_si256(low, high, 0x20));
+        _mm256_storeu_si256((__m256i *) (words + 2 * b + 4), _mm256_permute2x128_si256(low, high, 0x31));
+    }
+    philoxBlocks(key, counter + b, stream, words + 2 * b, blocks - b);
+}
+
+/**
+ * Return the Bernoulli trials of 32 random words like bernoulliMask, eight trials per vector.
+ *
+ * @param words 32 random words.
+ * @param threshold a trial succeeds, if its 32 bits are smaller, 0 < threshold < 2^32.
+ *
+ * @return the mask of the successful trials.
+ */
+__attribute__((target("avx2")))
+static uint64_t bernoulliMaskAVX2(const uint64_t *words, uint64_t threshold) {
+    // compare unsigned by flipping the sign bits
+    const __m256i sign = _mm256_set1_epi32((int) 0x80000000U);
+    const __m256i limit = _mm256_set1_epi32((int) (((uint32_t) threshold) ^ 0x80000000U));
+    uint64_t mask = 0;
+    for (int k = 0; k < 8; k++) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *) (words + 4 * k)), sign);
+        uint64_t successes = (uint64_t) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(limit, x)));
+        mask |= successes << (8 * k);
+    }
+    return(mask);
+}
+#endif
+
+/**
+ * Constructor for the RandomGenerator, each generator owns its state.
+ * Generators with the same seed and different streams yield independent numbers,
+ * which do not depend on the order, in which the generators are used.
  *
  * @param seed (starting value) for the random number generator
+ * @param algorithm LCG48: the 48 bit linear congruential generator of drand48
+ *                  (same numbers as srand48 / drand48 with the lower 32 bits of the seed),
+ *                  XOSHIRO256: xoshiro256** seeded by splitmix64,
+ *                  PHILOX: the counter based Philox4x32-10 with the seed as 64 bit key.
+ * @param stream the index of the stream, XOSHIRO256 jumps 2^128 numbers per stream,
+ *               PHILOX uses it as the upper half of the 128 bit counter.
+ *
+ * @exception invalid algorithm.
+ * @exception LCG48 has one stream only.
+ */
+ RandomGenerator::RandomGenerator(uint64_t seed, int algorithm, uint64_t stream) {
+    whichAlgorithm = algorithm;
+    bufferIndex = RANDOMBUFFERSIZE; // the first call fills the buffer
+#ifdef RANDOMGENERATORAVX2
+    useAVX2 = __builtin_cpu_supports("avx2");
+#else
+    useAVX2 = false;
+#endif
+    if (whichAlgorithm == LCG48) {
+        if (stream != 0) {
+            perror("The LCG48 generator has one stream only");
+            exit(EXIT_FAILURE);
+        }
+        // srand48 sets the upper 32 bits to the seed and the lower 16 bits to 0x330E
+        lcgState = ((seed & 0xFFFFFFFFULL) << 16) | 0x330EULL;
+    } else if (whichAlgorithm == XOSHIRO256) {
+        // fill the state with splitmix64, which never yields four zero words
+        uint64_t z = seed;
+        for (int i = 0; i < 4; i++) {
+            z += 0x9E3779B97F4A7C15ULL;
+            uint64_t x = z;
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+            xoshiroState[i] = x ^ (x >> 31);
+        }
+        for (uint64_t i = 0; i < stream; i++) {
+            RandomGenerator::jumpXoshiro();
+        }
+    } else if (whichAlgorithm == PHILOX) {
+        philoxKey[0] = (uint32_t) seed;
+        philoxKey[1] = (uint32_t) (seed >> 32);
+        philoxCounter = 0;
+        philoxStream = stream;
+    } else {
+        perror(("Invalid algorithm " + numToStr(algorithm)).c_str());
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Advance the state of the selected algorithm.
+ *
+ * @return 48 random bits (LCG48) or 64 random bits (XOSHIRO256, PHILOX).
+ */
+inline uint64_t RandomGenerator::nextState() {
+    if (whichAlgorithm == LCG48) {
+        // the multiplier and the increment of drand48
+        lcgState = (lcgState * 0x5DEECE66DULL + 0xBULL) & 0xFFFFFFFFFFFFULL;
+        return(lcgState);
+    } else if (whichAlgorithm == XOSHIRO256) {
+        return(nextXoshiro(xoshiroState));
+    } else {
+        // the blocks are independent, hence they are encrypted in advance
+        if (bufferIndex == RANDOMBUFFERSIZE) {
+            RandomGenerator::refillBuffer();
+        }
+        return(buffer[bufferIndex++]);
+    }
+}
+
+/**
+ * Encrypt the next RANDOMBUFFERSIZE / 2 blocks of PHILOX into the buffer.
+ */
+void RandomGenerator::refillBuffer() {
+#ifdef RANDOMGENERATORAVX2
+    if (useAVX2) {
+        philoxBlocksAVX2(philoxKey, philoxCounter, philoxStream, buffer, RANDOMBUFFERSIZE / 2);
+    } else {
+        philoxBlocks(philoxKey, philoxCounter, philoxStream, buffer, RANDOMBUFFERSIZE / 2);
+    }
+#else
+    philoxBlocks(philoxKey, philoxCounter, philoxStream, buffer, RANDOMBUFFERSIZE / 2);
+#endif
+    philoxCounter += RANDOMBUFFERSIZE / 2;
+    bufferIndex = 0;
+}
+
+/**
+ * Fill the given buffer with the next random words, which are the same
+ * words as the ones of count calls of nextState.
+ *
+ * @param words the buffer for the random words.
+ * @param count the number of random words.
+ */
+void RandomGenerator::randomWords(uint64_t *words, int count) {
+    if (whichAlgorithm == LCG48) {
+        uint64_t x = lcgState;
+        for (int i = 0; i < count; i++) {
+            x = (x * 0x5DEECE66DULL + 0xBULL) & 0xFFFFFFFFFFFFULL;
+            words[i] = x;
+        }
+        lcgState = x;
+    } else if (whichAlgorithm == XOSHIRO256) {
+        uint64_t s[4] = {xoshiroState[0], xoshiroState[1], xoshiroState[2], xoshiroState[3]};
+        for (int i = 0; i < count; i++) {
+            words[i] = nextXoshiro(s);
+        }
+        for (int j = 0; j < 4; j++) {
+            xoshiroState[j] = s[j];
+        }
+    } else {
+        int i = 0;
+        while (i < count) {
+            if (bufferIndex == RANDOMBUFFERSIZE) {
+                RandomGenerator::refillBuffer();
+            }
+            int available = RANDOMBUFFERSIZE - bufferIndex;
+            int n = (count - i < available) ? (count - i) : available;
+            for (int k = 0; k < n; k++) {
+                words[i + k] = buffer[bufferIndex + k];
+            }
+            bufferIndex += n;
+            i += n;
+        }
+    }
+}
+
+/**
+ * Advance the state of xoshiro256** by 2^128 numbers.
  */
- RandomGenerator::RandomGenerator(short unsigned int seed) {
-    // set the seed of the random number generator initially to the given seed
-    srand48(seed);
+void RandomGenerator::jumpXoshiro() {
+    static const uint64_t jump[4] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                     0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+    uint64_t s[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (jump[i] & (1ULL << b)) {
+                for (int j = 0; j < 4; j++) {
+                    s[j] ^= xoshiroState[j];
+                }
+            }
+            nextXoshiro(xoshiroState);
+        }
+    }
+    for (int j = 0; j < 4; j++) {
+        xoshiroState[j] = s[j];
+    }
 }
 
 /**
@@ -38,7 +333,15 @@
  * @return the randomly choosen vertex index
  */
 int RandomGenerator::randomVertex(int numberOfVertices) {
-    return((int) (RandomGenerator::randomNumber() * ((double) numberOfVertices)));
+    // scale the random bits by an integer multiplication instead of a double
+    uint64_t bits = RandomGenerator::nextState();
+    if (whichAlgorithm == LCG48) {
+        // floor(bits * numberOfVertices / 2^48) split into two products, which do not overflow
+        uint64_t n = (uint64_t) numberOfVertices;
+        return((int) ((((bits >> 24) * n) + (((bits & 0xFFFFFFULL) * n) >> 24)) >> 24));
+    } else {
+        return((int) (((bits >> 32) * (uint64_t) numberOfVertices) >> 32));
+    }
 }
 
 /**
@@ -47,5 +350,118 @@ int RandomGenerator::randomVertex(int numberOfVertices) {
  * @return The random number.
  */
 double RandomGenerator::randomNumber() {
-    return (drand48());
+    if (whichAlgorithm == LCG48) {
+        // drand48 returns the 48 bits divided by 2^48
+        return (((double) RandomGenerator::nextState()) * (1.0 / 281474976710656.0));
+    } else {
+        // the upper 53 bits fill the mantissa
+        return (((double) (RandomGenerator::nextState() >> 11)) * (1.0 / 9007199254740992.0));
+    }
+}
+
+/**
+ * Return a random integer in [0, RANDOMINTEGERRANGE), which uses the same
+ * random number as randomNumber without the conversion to double.
+ *
+ * @return The random integer.
+ */
+long RandomGenerator::randomInteger() {
+    if (whichAlgorithm == LCG48) {
+        // lrand48 returns the upper 31 bits of the state used by drand48
+        return ((long) (RandomGenerator::nextState() >> 17));
+    } else {
+        return ((long) (RandomGenerator::nextState() >> 33));
+    }
+}
+
+/**
+ * Return the number of failed Bernoulli trials before the next success
+ * (geometric distribution), which costs one random number.
+ *
+ * @param logComplement log(1 - p), where p is the probability of a success.
+ *
+ * @return the number of failed trials, at most 10^18, which is returned for p = 0.
+ */
+long long RandomGenerator::randomSkip(double logComplement) {
+    // randomNumber is in [0, 1), hence the logarithm is finite
+    double skip = floor(log(1.0 - RandomGenerator::randomNumber()) / logComplement);
+    // p = 0 means log(1 - p) = +0, hence the quotient is -infinity (or NaN for a zero random
+    // number), which would make the conversion undefined, so all these cases return the cap
+    if (!((skip >= 0.0) && (skip < 1e18))) {
+        return(1000000000000000000LL);
+    }
+    return((long long) skip);
+}
+
+/**
+ * Fill the given buffer with random numbers in [0, 1), which are the same
+ * numbers as the ones of count calls of randomNumber.
+ *
+ * @param numbers the buffer for the random numbers.
+ * @param count the number of random numbers.
+ */
+void RandomGenerator::randomNumbers(double *numbers, int count) {
+    uint64_t words[RANDOMBUFFERSIZE];
+    int i = 0;
+    while (i < count) {
+        // generate and convert the words in chunks
+        int n = (count - i < RANDOMBUFFERSIZE) ? (count - i) : RANDOMBUFFERSIZE;
+        RandomGenerator::randomWords(words, n);
+        if (whichAlgorithm == LCG48) {
+            for (int k = 0; k < n; k++) {
+                numbers[i + k] = ((double) words[k]) * (1.0 / 281474976710656.0);
+            }
+        } else {
+            for (int k = 0; k < n; k++) {
+                numbers[i + k] = ((double) (words[k] >> 11)) * (1.0 / 9007199254740992.0);
+            }
+        }
+        i += n;
+    }
+}
+
+/**
+ * Fill the given buffer with the results of Bernoulli trials, bit k of bits[w]
+ * is one with the given probability and belongs to trial 64 * w + k.
+ * Each word of the buffer costs 64 trials, the unused bits of the last word are zero.
+ *
+ * @param bits the buffer for (count + 63) / 64 words.
+ * @param count the number of trials.
+ * @param probability the probability of a one.
+ */
+void RandomGenerator::randomBits(uint64_t *bits, int count, double probability) {
+    // a trial succeeds, if its 32 random bits are smaller than the threshold
+    uint64_t threshold = 0;
+    if (probability >= 1.0) {
+        threshold = 1ULL << 32;
+    } else if (probability > 0.0) {
+        threshold = (uint64_t) (probability * 4294967296.0);
+    }
+    // the 64 bit algorithms provide two trials per word, LCG48 one trial with its upper 32 bits
+    int wordsPerMask = (whichAlgorithm == LCG48) ? 64 : 32;
+    uint64_t words[64];
+    for (int w = 0; w < (count + 63) / 64; w++) {
+        uint64_t mask = 0;
+        if (threshold == (1ULL << 32)) {
+            mask = ~0ULL;
+        } else if (threshold > 0) {
+            RandomGenerator::randomWords(words, wordsPerMask);
+            if (whichAlgorithm == LCG48) {
+                for (int k = 0; k < 64; k++) {
+                    mask |= ((uint64_t) ((words[k] >> 16) < threshold)) << k;
+                }
+#ifdef RANDOMGENERATORAVX2
+            } else if (useAVX2) {
+                mask = bernoulliMaskAVX2(words, threshold);
+#endif
+            } else {
+                mask = bernoulliMask(words, threshold);
+            }
+        }
+        if (count - 64 * w < 64) {
+            // clear the bits after the last trial
+            mask &= (1ULL << (count - 64 * w)) - 1;
+        }
+        bits[w] = mask;
+    }
 }
@@ -21,8 +21,26 @@
 #ifndef RANDOMGENERATOR_H_INCLUDED
 #define RANDOMGENERATOR_H_INCLUDED
 
+#include <stdint.h>
 #include <stdlib.h>
 
+/**
+ * Define the number of different random integers.
+ */
+#define RANDOMINTEGERRANGE 2147483648L
+
+/**
+ * Define the algorithms of the random generator.
+ */
+#define LCG48 0
+#define XOSHIRO256 1
+#define PHILOX 2
+
+/**
+ * Define the number of random words, which are encrypted at once by PHILOX.
+ */
+#define RANDOMBUFFERSIZE 256
+
 /**
  * Define a class for generating random vertex indices.
  * Easily exchanging the random generator should be possible.
@@ -30,11 +48,22 @@
 class RandomGenerator {
 public:
     /**
-     * Constructor for the RandomGenerator.
+     * Constructor for the RandomGenerator, each generator owns its state.
+     * Generators with the same seed and different streams yield independent numbers,
+     * which do not depend on the order, in which the generators are used.
      *
      * @param seed (starting value) for the random number generator
+     * @param algorithm LCG48: the 48 bit linear congruential generator of drand48
+     *                  (same numbers as srand48 / drand48 with the lower 32 bits of the seed),
+     *                  XOSHIRO256: xoshiro256** seeded by splitmix64,
+     *                  PHILOX: the counter based Philox4x32-10 with the seed as 64 bit key.
+     * @param stream the index of the stream, XOSHIRO256 jumps 2^128 numbers per stream,
+     *               PHILOX uses it as the upper half of the 128 bit counter.
+     *
+     * @exception invalid algorithm.
+     * @exception LCG48 has one stream only.
      */
-    RandomGenerator(short unsigned int seed);
+    RandomGenerator(uint64_t seed, int algorithm = LCG48, uint64_t stream = 0);
 
     /**
      * Randomly draw a vertex index.
@@ -51,6 +80,81 @@ public:
      * @return The random number.
      */
      double randomNumber();
+
+    /**
+     * Return a random integer in [0, RANDOMINTEGERRANGE), which uses the same
+     * random number as randomNumber without the conversion to double.
+     *
+     * @return The random integer.
+     */
+    long randomInteger();
+
+    /**
+     * Return the number of failed Bernoulli trials before the next success
+     * (geometric distribution), which costs one random number.
+     *
+     * @param logComplement log(1 - p), where p is the probability of a success.
+     *
+     * @return the number of failed trials, at most 10^18, which is returned for p = 0.
+     */
+    long long randomSkip(double logComplement);
+
+    /**
+     * Fill the given buffer with random numbers in [0, 1), which are the same
+     * numbers as the ones of count calls of randomNumber.
+     *
+     * @param numbers the buffer for the random numbers.
+     * @param count the number of random numbers.
+     */
+    void randomNumbers(double *numbers, int count);
+
+    /**
+     * Fill the given buffer with the results of Bernoulli trials, bit k of bits[w]
+     * is one with the given probability and belongs to trial 64 * w + k.
+     * Each word of the buffer costs 64 trials, the unused bits of the last word are zero.
+     *
+     * @param bits the buffer for (count + 63) / 64 words.
+     * @param count the number of trials.
+     * @param probability the probability of a one.
+     */
+    void randomBits(uint64_t *bits, int count, double probability);
+
+private:
+    int whichAlgorithm;
+    uint64_t lcgState; // the 48 bits of the linear congruential generator
+    uint64_t xoshiroState[4];
+    uint32_t philoxKey[2];
+    uint64_t philoxCounter; // the number of the next block
+    uint64_t philoxStream;
+    uint64_t buffer[RANDOMBUFFERSIZE]; // the random words encrypted in advance
+    int bufferIndex;                   // the next unused word of the buffer
+    bool useAVX2;
+
+    /**
+     * Advance the state of the selected algorithm.
+     *
+     * @return 48 random bits (LCG48) or 64 random bits (XOSHIRO256, PHILOX).
+     */
+    uint64_t nextState();
+
+    /**
+     * Encrypt the next RANDOMBUFFERSIZE / 2 blocks of PHILOX into the buffer.
+     */
+    void refillBuffer();
+
+    /**
+     * Fill the given buffer with the next random words, which are the same
+     * words as the ones of count calls of nextState.
+     *
+     * @param words the buffer for the random words.
+     * @param count the number of random words.
+     */
+    void randomWords(uint64_t *words, int count);
+
+    /**
+     * Advance the state of xoshiro256** by 2^128 numbers.
+     */
+    void jumpXoshiro();
 };
 
 #endif // RANDOMGENERATOR_H_INCLUDED
@@ -0,0 +1,370 @@
+/*
+ * randomGraph.h
+ * Copyright (C) 2016, 2017 flossCoder
+ *
+ * This file is part of largeDevSBM.
+ *
+ * largeDevSBM is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * largeDevSBM is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RANDOMGRAPH_H_INCLUDED
+#define RANDOMGRAPH_H_INCLUDED
+
+#include "abstractGraph.h" // Base class: AbstractGraph
+
+/**
+ * Define the probability, from which on the pairs of two blocks are sampled by Bernoulli masks
+ * of 64 pairs instead of geometric skips, which cost a logarithm per edge.
+ */
+#define MASKPROBABILITY 0.2
+
+/**
+ * Define the sampling of random graphs, where the vertices are partitioned into blocks
+ * and each edge between the blocks a and b is present with the same probability.
+ * The model is given at compile time (curiously recurring template pattern), it must provide
+ * the inline functions getNumberOfBlocks(), getBlockSize(block), getBlockMember(block, index),
+ * getBlock(vertex), getLogComplement(block1, block2) and getProbability(block1, block2),
+ * hence they are inlined into the sampling loops without any virtual call.
+ */
+template <class Model>
+class RandomGraph : public AbstractGraph {
+public:
+    /**
+     * Constructor for setting up an empty random graph.
+     *
+     * @param n number of vertices
+     * @param generator a random number generator
+     * @param digraph true: digraph, false: no digraph
+     * @param loopsAllowed true: loops enabled, false: loops disabled
+     * @param storage ADJACENCYMATRIX, ADJACENCYLIST or BITMATRIX
+     * @param components COMPONENTSEARCH, COMPONENTTRACKING or DYNAMICCONNECTIVITY
+     * @param digraphComponents REACHABLECOMPONENTS, WEAKCOMPONENTS or STRONGCOMPONENTS
+     */
+    RandomGraph(int n, RandomGenerator* generator, bool digraph, bool loopsAllowed, int storage,
+                int components, int digraphComponents)
+    : AbstractGraph(n, generator, digraph, loopsAllowed, storage, components, digraphComponents) {
+    }
+
+    /**
+     * Generate a graph with randomly setted edges. Each pair of blocks is sampled
+     * separately with its probability, where the number of pairs until the next inserted
+     * edge is drawn from a geometric distribution (Batagelj and Brandes),
+     * hence this costs O(N + M + B^2). Dense pairs of blocks are sampled by Bernoulli masks.
+     */
+    virtual void generateRandom();
+
+protected:
+    /**
+     * This function proposes for the given index all feasible edges with
+     * a certain probability. The members of each block are skipped geometrically,
+     * hence this costs O(B + c) random numbers instead of O(N). The members of dense
+     * blocks are sampled by Bernoulli masks.
+     *
+     * @param vertex the index of the given vertex
+     */
+    virtual void proposeEdgesRandom(int vertex);
+
+private:
+    /**
+     * Insert the edges between the members of all pairs of blocks with their probability.
+     *
+     * @tparam digraph true: digraph, false: no digraph, must equal isDigraph
+     * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled()
+     */
+    template <bool digraph, bool loops>
+    void sampleBlocks();
+
+    /**
+     * Insert the edges between the members of both blocks with their probability.
+     * For undirected graphs and block1 == block2 each pair is considered once.
+     *
+     * @tparam digraph true: digraph, false: no digraph, must equal isDigraph
+     * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled()
+     *
+     * @param block1 index of the block of the heads of the edges
+     * @param block2 index of the block of the tails of the edges
+     */
+    template <bool digraph, bool loops>
+    void sampleBlockPair(int block1, int block2);
+
+    /**
+     * Propose the edges of the given vertex to the members of all blocks.
+     *
+     * @tparam digraph true: digraph, false: no digraph, must equal isDigraph
+     * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled()
+     *
+     * @param vertex the index of the given vertex
+     */
+    template <bool digraph, bool loops>
+    void proposeBlockEdges(int vertex);
+
+    /**
+     * Insert the edges between the members of both blocks drawing a Bernoulli mask
+     * for each 64 pairs, the pairs are numbered like in sampleBlockPair.
+     *
+     * @tparam digraph true: digraph, false: no digraph, must equal isDigraph
+     * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled()
+     *
+     * @param block1 index of the block of the heads of the edges
+     * @param block2 index of the block of the tails of the edges
+     * @param probability the probability of an edge
+     */
+    template <bool digraph, bool loops>
+    void sampleBlockPairMasks(int block1, int block2, double probability);
+};
+
+/**
+ * Generate a graph with randomly setted edges. Each pair of blocks is sampled
+ * separately with its probability, where the number of pairs until the next inserted
+ * edge is drawn from a geometric distribution (Batagelj and Brandes),
+ * hence this costs O(N + M + B^2). Dense pairs of blocks are sampled by Bernoulli masks.
+ */
+template <class Model>
+void RandomGraph<Model>::generateRandom() {
+    if (getNumberOfEdges() != 0) {
+        resetGraph();
+    }
+    // decide about the flags once, the sampling loops are specialized
+    if (isDigraph) {
+        if (getLoopsEnabled()) {
+            RandomGraph<Model>::sampleBlocks<true, true>();
+        } else {
+            RandomGraph<Model>::sampleBlocks<true, false>();
+        }
+    } else {
+        if (getLoopsEnabled()) {
+            RandomGraph<Model>::sampleBlocks<false, true>();
+        } else {
+            RandomGraph<Model>::sampleBlocks<false, false>();
+        }
+    }
+}
+
+/**
+ * This function proposes for the given index all feasible edges with
+ * a certain probability. The members of each block are skipped geometrically,
+ * hence this costs O(B + c) random numbers instead of O(N). The members of dense
+ * blocks are sampled by Bernoulli masks.
+ *
+ * @param vertex the index of the given vertex
+ */
+template <class Model>
+void RandomGraph<Model>::proposeEdgesRandom(int vertex) {
+    // decide about the flags once, the sampling loops are specialized
+    if (isDigraph) {
+        if (getLoopsEnabled()) {
+            RandomGraph<Model>::proposeBlockEdges<true, true>(vertex);
+        } else {
+            RandomGraph<Model>::proposeBlockEdges<true, false>(vertex);
+        }
+    } else {
+        if (getLoopsEnabled()) {
+            RandomGraph<Model>::proposeBlockEdges<false, true>(vertex);
+        } else {
+            RandomGraph<Model>::proposeBlockEdges<false, false>(vertex);
+        }
+    }
+}
+
+/**
+ * Insert the edges between the members of all pairs of blocks with their probability.
+ *
+ * @tparam digraph true: digraph, false: no digraph, must equal isDigraph
+ * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled()
+ */
+template <class Model>
+template <bool digraph, bool loops>
+void RandomGraph<Model>::sampleBlocks() {
+    int blocks = static_cast<Model *>(this)->getNumberOfBlocks();
+    for (int a = 0; a < blocks; a++) {
+        // undirected graphs: each pair of blocks just once
+        for (int b = (digraph ? 0 : a); b < blocks; b++) {
+            RandomGraph<Model>::sampleBlockPair<digraph, loops>(a, b);
+        }
+    }
+}
+
+/**
+ * Insert the edges between the members of both blocks with their probability.
+ * For undirected graphs and block1 == block2 each pair is considered once.
+ *
+ * @tparam digraph true: digraph, false: no digraph, must equal isDigraph
+ * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled()
+ *
+ * @param block1 index of the block of the heads of the edges
+ * @param block2 index of the block of the tails of the edges
+ */
+template <class Model>
+template <bool digraph, bool loops>
+void RandomGraph<Model>::sampleBlockPair(int block1, int block2) {
+    Model *model = static_cast<Model *>(this);
+    long long rows = model->getBlockSize(block1);
+    long long columns = model->getBlockSize(block2);
+    if ((rows == 0) || (columns == 0)) {
+        return;
+    }
+    double probability = model->getProbability(block1, block2);
+    if (probability <= 0.0) {
+        // no edges, e.g. disjoint blocks, log(1 - p) = 0 is not suited for the skips
+        return;
+    }
+    if (probability >= MASKPROBABILITY) {
+        // includes p = 1, where all masks are full
+        RandomGraph<Model>::sampleBlockPairMasks<digraph, loops>(block1, block2, probability);
+        return;
+    }
+    double logComplement = model->getLogComplement(block1, block2);
+    long long i = 0;
+    long long j = -1;
+    if (!digraph && (block1 == block2)) {
+        // row i contains the columns i, ..., columns - 1, because the pairs are unordered
+        while (true) {
+            j += 1 + randomGenerator->randomSkip(logComplement);
+            while ((j >= columns) && (i < rows)) {
+                i++;
+                j = j - columns + i;
+            }
+            if (i >= rows) {
+                break;
+            }
+            insertEdge<digraph, loops>(model->getBlockMember(block1, (int) i), model->getBlockMember(block2, (int) j));
+        }
+    } else {
+        while (true) {
+            j += 1 + randomGenerator->randomSkip(logComplement);
+            if (j >= columns) {
+                i += j / columns;
+                j = j % columns;
+            }
+            if (i >= rows) {
+                break;
+            }
+            insertEdge<digraph, loops>(model->getBlockMember(block1, (int) i), model->getBlockMember(block2, (int) j));
+        }
+    }
+}
+
+/**
+ * Propose the edges of the given vertex to the members of all blocks.
+ *
+ * @tparam digraph true: digraph, false: no digraph, must equal isDigraph
+ * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled()
+ *
+ * @param vertex the index of the given vertex
+ */
+template <class Model>
+template <bool digraph, bool loops>
+void RandomGraph<Model>::proposeBlockEdges(int vertex) {
+    Model *model = static_cast<Model *>(this);
+    int blocks = model->getNumberOfBlocks();
+    int block = model->getBlock(vertex);
+    for (int b = 0; b < blocks; b++) {
+        double probability = model->getProbability(block, b);
+        long long size = model->getBlockSize(b);
+        if (probability <= 0.0) {
+            // no edges to this block, log(1 - p) = 0 is not suited for the skips
+            continue;
+        }
+        if (probability >= MASKPROBABILITY) {
+            // one bit per pair, the pairs are numbered like below
+            long long pairs = digraph ? 2 * size : size;
+            for (long long base = 0; base < pairs; base += 64) {
+                uint64_t mask;
+                randomGenerator->randomBits(&mask, (pairs - base < 64) ? (int) (pairs - base) : 64, probability);
+                while (mask != 0) {
+                    long long k = base + __builtin_ctzll(mask);
+                    mask &= mask - 1;
+                    if (!digraph) {
+                        proposeEdge<loops>(vertex, model->getBlockMember(b, (int) k));
+                    } else if (k % 2 == 0) {
+                        proposeEdge<loops>(vertex, model->getBlockMember(b, (int) (k / 2)));
+                    } else {
+                        proposeEdge<loops>(model->getBlockMember(b, (int) (k / 2)), vertex);
+                    }
+                }
+            }
+            continue;
+        }
+        double logComplement = model->getLogComplement(block, b);
+        long long k = -1;
+        if (digraph) {
+            // the pairs are (vertex, m_0), (m_0, vertex), (vertex, m_1), (m_1, vertex), ...
+            while (true) {
+                k += 1 + randomGenerator->randomSkip(logComplement);
+                if (k >= 2 * size) {
+                    break;
+                }
+                if (k % 2 == 0) {
+                    proposeEdge<loops>(vertex, model->getBlockMember(b, (int) (k / 2)));
+                } else {
+                    proposeEdge<loops>(model->getBlockMember(b, (int) (k / 2)), vertex);
+                }
+            }
+        } else {
+            while (true) {
+                k += 1 + randomGenerator->randomSkip(logComplement);
+                if (k >= size) {
+                    break;
+                }
+                proposeEdge<loops>(vertex, model->getBlockMember(b, (int) k));
+            }
+        }
+    }
+}
+
+/**
+ * Insert the edges between the members of both blocks drawing a Bernoulli mask
+ * for each 64 pairs, the pairs are numbered like in sampleBlockPair.
+ *
+ * @tparam digraph true: digraph, false: no digraph, must equal isDigraph
+ * @tparam loops true: loops enabled, false: loops disabled, must equal getLoopsEnabled()
+ *
+ * @param block1 index of the block of the heads of the edges
+ * @param block2 index of the block of the tails of the edges
+ * @param probability the probability of an edge
+ */
+template <class Model>
+template <bool digraph, bool loops>
+void RandomGraph<Model>::sampleBlockPairMasks(int block1, int block2, double probability) {
+    Model *model = static_cast<Model *>(this);
+    long long rows = model->getBlockSize(block1);
+    long long columns = model->getBlockSize(block2);
+    uint64_t mask;
+    if (!digraph && (block1 == block2)) {
+        // row i contains the columns i, ..., columns - 1, because the pairs are unordered
+        for (long long i = 0; i < rows; i++) {
+            for (long long base = i; base < columns; base += 64) {
+                randomGenerator->randomBits(&mask, (columns - base < 64) ? (int) (columns - base) : 64, probability);
+                while (mask != 0) {
+                    long long j = base + __builtin_ctzll(mask);
+                    mask &= mask - 1;
+                    insertEdge<digraph, loops>(model->getBlockMember(block1, (int) i), model->getBlockMember(block2, (int) j));
+                }
+            }
+        }
+    } else {
+        long long pairs = rows * columns;
+        for (long long base = 0; base < pairs; base += 64) {
+            randomGenerator->randomBits(&mask, (pairs - base < 64) ? (int) (pairs - base) : 64, probability);
+            while (mask != 0) {
+                long long t = base + __builtin_ctzll(mask);
+                mask &= mask - 1;
+                insertEdge<digraph, loops>(model->getBlockMember(block1, (int) (t / columns)),
+                                           model->getBlockMember(block2, (int) (t % columns)));
+            }
+        }
+    }
+}
+
+#endif // RANDOMGRAPH_H_INCLUDED
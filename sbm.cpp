@@ -20,6 +20,8 @@
 
 #include "sbm.h"
 
+#include <math.h>
+
 /**
  * Constructor for setting up an empty SBM graph.
  *
@@ -30,10 +32,14 @@
  * @param generator a random number generator
  * @param digraph true (default): digraph, false: no digraph
  * @param loopsAllowed true (default): loops enabled, false: loops disabled
+ * @param storage ADJACENCYMATRIX (default), ADJACENCYLIST or BITMATRIX
+ * @param components COMPONENTSEARCH (default), COMPONENTTRACKING or DYNAMICCONNECTIVITY
+ * @param digraphComponents REACHABLECOMPONENTS (default), WEAKCOMPONENTS or STRONGCOMPONENTS
  */
 SBM::SBM(double interConnectivity, double intraConnectivity, int blocks,
-int n, RandomGenerator* generator, bool digraph, bool loopsAllowed)
-: AbstractGraph(n, generator, digraph, loopsAllowed) {
+int n, RandomGenerator* generator, bool digraph, bool loopsAllowed, int storage, int components,
+int digraphComponents)
+: RandomGraph<SBM>(n, generator, digraph, loopsAllowed, storage, components, digraphComponents) {
     interBlockConnectivity = interConnectivity;
     intraBlockConnectivity = intraConnectivity;
     numberOfBlocks = blocks;
@@ -50,13 +56,35 @@ int n, RandomGenerator* generator, bool digraph, bool loopsAllowed)
     for (i = 0; i < blocks; i++) {
         blockCounter[i] = 0;
     }
-    // add all vertices randomly to one block
+    // add all vertices randomly to one block, the random numbers are drawn at once
+    double *uniforms = new double[n];
+    randomGenerator->randomNumbers(uniforms, n);
     for (i = 0; i < n; i++) {
-        blockIndex = blocks * randomGenerator->randomNumber();
+        blockIndex = blocks * uniforms[i];
         //std::cout << blockIndex << std::endl;
         labeling[i] = blockIndex;
         blockCounter[blockIndex] = blockCounter[blockIndex] + 1;
     }
+    delete [] uniforms;
+    // group the vertices by their block, within a block the vertices are sorted
+    blockStart = new int[blocks + 1];
+    blockMembers = new int[n];
+    blockStart[0] = 0;
+    for (i = 0; i < blocks; i++) {
+        blockStart[i + 1] = blockStart[i] + blockCounter[i];
+    }
+    int *position = new int[blocks];
+    for (i = 0; i < blocks; i++) {
+        position[i] = blockStart[i];
+    }
+    for (i = 0; i < n; i++) {
+        blockMembers[position[labeling[i]]] = i;
+        position[labeling[i]]++;
+    }
+    delete [] position;
+    // log(1 - p) for the geometric skips, p > 1 means that all edges are inserted
+    logInterComplement = (interProbability < 1.0) ? log(1.0 - interProbability) : -HUGE_VAL;
+    logIntraComplement = (intraProbability < 1.0) ? log(1.0 - intraProbability) : -HUGE_VAL;
 }
 
 /**
@@ -65,26 +93,8 @@ int n, RandomGenerator* generator, bool digraph, bool loopsAllowed)
 SBM::~SBM() {
     delete [] labeling;
     delete [] blockCounter;
-}
-
-/**
- * Should the edge (vertex1, vertex2) be inserted?
- * This function is abstract and must be implemented by inheriting classes.
- *
- * @param vertex1 index of the head of the proposed edge
- * @param vertex2 index of the target of the propose edge
- *
- * @return true: insert the proposed edge;
- *    false: do not insert the proposed edge
- */
-bool SBM::mustInsertEdge(int vertex1, int vertex2) {
-    if (labeling[vertex1] == labeling[vertex2]) {
-        // case: both vertices are in the same block
-        return (randomGenerator->randomNumber() <= intraProbability);
-    } else {
-        // case: both vertices are in different blocks
-        return (randomGenerator->randomNumber() <= interProbability);
-    }
+    delete [] blockStart;
+    delete [] blockMembers;
 }
 
 /******************* save results *******************/
@@ -106,17 +116,7 @@ void SBM::saveGraphToGraphviz(const std::string directory, const std::string fil
         outfile << "graph G {" << std::endl;
     }
     // write all edges to file
-    for (int i = 0; i < getNumberOfVertices(); i++) {
-        for (int j = 0; j < getNumberOfVertices(); j++) {
-            if (adjacencyMatrix[i][j]) {
-                if (isDigraph) {
-                    outfile << i << " -> " << j << std::endl;
-                } else {
-                    outfile << i << " -- " << j << std::endl;
-                }
-            }
-        }
-    }
+    writeEdgesToGraphviz(outfile);
 
     for (int i = 0; i < getNumberOfVertices(); i++) {
         if (labeling[i] == 0) {
@@ -21,12 +21,12 @@
 #ifndef SBM_H_INCLUDED
 #define SBM_H_INCLUDED
 
-#include "abstractGraph.h"
+#include "randomGraph.h"
 
 /**
- * Implementation of the stochastic blockmodel.
+ * Implementation of the stochastic blockmodel based on RandomGraph.
  */
-class SBM : public AbstractGraph {
+class SBM : public RandomGraph<SBM> {
 public:
     /**
      * Constructor for setting up an empty SBM graph.
@@ -38,10 +38,14 @@ public:
      * @param generator a random number generator
      * @param digraph true (default): digraph, false: no digraph
      * @param loopsAllowed true (default): loops enabled, false: loops disabled
+     * @param storage ADJACENCYMATRIX (default), ADJACENCYLIST or BITMATRIX
+     * @param components COMPONENTSEARCH (default), COMPONENTTRACKING or DYNAMICCONNECTIVITY
+     * @param digraphComponents REACHABLECOMPONENTS (default), WEAKCOMPONENTS or STRONGCOMPONENTS
      */
     SBM(double interConnectivity, double intraConnectivity, int blocks,
         int n, RandomGenerator* generator,
-        bool digraph = false, bool loopsAllowed = false);
+        bool digraph = false, bool loopsAllowed = false, int storage = ADJACENCYMATRIX,
+        int components = COMPONENTSEARCH, int digraphComponents = REACHABLECOMPONENTS);
 
     /**
      * Destructor.
@@ -49,24 +53,85 @@ public:
     ~SBM();
 
     /**
-     * Should the edge (vertex1, vertex2) be inserted?
-     * This function is abstract and must be implemented by inheriting classes.
+     * Save the graph as graphviz file.
      *
-     * @param vertex1 index of the head of the proposed edge
-     * @param vertex2 index of the target of the propose edge
+     * @param directory where the file should be saved.
+     * @param fileName name of the graphviz file to save.
+     */
+    void saveGraphToGraphviz(const std::string directory, const std::string fileName);
+
+    /**
+     * The model of RandomGraph: return the number of blocks.
      *
-     * @return true: insert the proposed edge;
-     *    false: do not insert the proposed edge
+     * @return the number of blocks
      */
-    virtual bool mustInsertEdge(int vertex1, int vertex2);
+    inline int getNumberOfBlocks()
+    {
+        return(numberOfBlocks);
+    }
 
     /**
-     * Save the graph as graphviz file.
+     * The model of RandomGraph: return the number of vertices of the given block.
      *
-     * @param directory where the file should be saved.
-     * @param fileName name of the graphviz file to save.
+     * @param block index of the block
+     *
+     * @return the number of vertices of the block
      */
-    void saveGraphToGraphviz(const std::string directory, const std::string fileName);
+    inline int getBlockSize(int block)
+    {
+        return(blockCounter[block]);
+    }
+
+    /**
+     * The model of RandomGraph: return the vertex with the given index in the given block.
+     *
+     * @param block index of the block
+     * @param index index of the vertex in the block
+     *
+     * @return the index of the vertex
+     */
+    inline int getBlockMember(int block, int index)
+    {
+        return(blockMembers[blockStart[block] + index]);
+    }
+
+    /**
+     * The model of RandomGraph: return the block of the given vertex.
+     *
+     * @param vertex index of the vertex
+     *
+     * @return the index of the block
+     */
+    inline int getBlock(int vertex)
+    {
+        return(labeling[vertex]);
+    }
+
+    /**
+     * The model of RandomGraph: return log(1 - p) for the edges between both blocks.
+     *
+     * @param block1 index of the first block
+     * @param block2 index of the second block
+     *
+     * @return log(1 - p), where p is the intra or inter block probability
+     */
+    inline double getLogComplement(int block1, int block2)
+    {
+        return((block1 == block2) ? logIntraComplement : logInterComplement);
+    }
+
+    /**
+     * The model of RandomGraph: return the probability of the edges between both blocks.
+     *
+     * @param block1 index of the first block
+     * @param block2 index of the second block
+     *
+     * @return p, the intra or inter block probability
+     */
+    inline double getProbability(int block1, int block2)
+    {
+        return((block1 == block2) ? intraProbability : interProbability);
+    }
 
 private:
     double interBlockConnectivity;
@@ -74,8 +139,12 @@ private:
     double interProbability;
     double intraProbability;
     int numberOfBlocks;
+    double logInterComplement;
+    double logIntraComplement;
     int *labeling;
     int *blockCounter;
+    int *blockStart;
+    int *blockMembers;
 };
 
 #endif // SBM_H_INCLUDED